@@ -0,0 +1,149 @@
+// 分配计数：替换全局 operator new，按线程统计分配次数与字节数
+// 本文件单独链接为 xswl_signals_bench_alloc，替换不影响其他基准
+#include "bench_common.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+struct alloc_counts
+{
+    std::size_t allocs;
+    std::size_t bytes;
+};
+
+thread_local alloc_counts t_counts = {0, 0};
+
+} // namespace
+
+void *operator new(std::size_t n)
+{
+    ++t_counts.allocs;
+    t_counts.bytes += n;
+    void *p = std::malloc(n ? n : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new[](std::size_t n)
+{
+    return ::operator new(n);
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+
+// 先运行若干次使状态稳定（快照、标签表等已建立），再统计 op 的平均分配，最后照常计时
+template <typename Op>
+static void measure_allocs(BenchState &state, Op op)
+{
+    const std::size_t warm = 16;
+    const std::size_t ops = 10000;
+    for (std::size_t i = 0; i < warm; ++i)
+        op();
+
+    alloc_counts before = t_counts;
+    for (std::size_t i = 0; i < ops; ++i)
+        op();
+    alloc_counts after = t_counts;
+
+    state.counter("allocs/op", static_cast<double>(after.allocs - before.allocs) / ops);
+    state.counter("bytes/op", static_cast<double>(after.bytes - before.bytes) / ops);
+    state.run(op);
+}
+
+BENCH_CASE(alloc_emit_1_slot)
+{
+    xswl::signal_t<int> sig;
+    int sink = 0;
+    sig.connect([&sink](int v) { sink += v; });
+    measure_allocs(state, [&]() { sig(1); });
+    bench_keep(sink);
+}
+
+BENCH_CASE(alloc_emit_10_slots)
+{
+    xswl::signal_t<int> sig;
+    int sink = 0;
+    for (int i = 0; i < 10; ++i)
+        sig.connect([&sink](int v) { sink += v; }, i);
+    measure_allocs(state, [&]() { sig(1); });
+    bench_keep(sink);
+}
+
+BENCH_CASE(alloc_emit_tracked)
+{
+    struct Obj
+    {
+        int sink = 0;
+        void on(int v) { sink += v; }
+    };
+    auto obj = std::make_shared<Obj>();
+    xswl::signal_t<int> sig;
+    sig.connect(obj, &Obj::on);
+    measure_allocs(state, [&]() { sig(1); });
+    bench_keep(obj->sink);
+}
+
+BENCH_CASE(alloc_connect_disconnect)
+{
+    xswl::signal_t<int> sig;
+    measure_allocs(state, [&]() {
+        auto conn = sig.connect([](int) {});
+        conn.disconnect();
+        sig(1); // 回收已断开的槽
+    });
+}
+
+BENCH_CASE(alloc_connect_once)
+{
+    xswl::signal_t<int> sig;
+    measure_allocs(state, [&]() {
+        sig.connect_once([](int) {});
+        sig(1);
+    });
+}
+
+BENCH_CASE(alloc_connect_tagged)
+{
+    xswl::signal_t<int> sig;
+    const std::string tag("bench");
+    measure_allocs(state, [&]() {
+        sig.connect(tag, [](int) {});
+        sig.disconnect(tag);
+        sig(1);
+    });
+}
+
+BENCH_CASE(alloc_scoped_connection)
+{
+    xswl::signal_t<int> sig;
+    measure_allocs(state, [&]() {
+        {
+            xswl::scoped_connection_t scoped = sig.connect([](int) {});
+            bench_keep(scoped);
+        }
+        sig(1);
+    });
+}
+
+BENCH_CASE(alloc_connection_group_10)
+{
+    xswl::signal_t<int> sig;
+    measure_allocs(state, [&]() {
+        xswl::connection_group_t group;
+        for (int i = 0; i < 10; ++i)
+            group += sig.connect([](int) {});
+        group.disconnect_all();
+        sig(1);
+    });
+}
@@ -0,0 +1,596 @@
+#pragma once
+
+#include "xswl/signals.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+// 基准注册宏：函数体内构造场景，再调用 state.run / state.run_parallel 计时
+#define BENCH_CASE(name) \
+    void bench_##name(BenchState &state); \
+    struct BenchRegister_##name { \
+        BenchRegister_##name() { \
+            BenchRunner::instance().add(#name, bench_##name); \
+        } \
+    } g_bench_register_##name; \
+    void bench_##name(BenchState &state)
+
+// 防止编译器把被测结果优化掉
+template <typename T>
+inline void bench_keep(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "g"(&value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+// 运行参数（由命令行解析）
+struct BenchOptions
+{
+    BenchOptions()
+        : repeats(20), warmup_ms(50), sample_ms(10), latency_ops(20000),
+          pin(true), cpu(-1), json(false)
+    {
+    }
+
+    int repeats;          // 每个场景的采样次数
+    int warmup_ms;        // 计时前的预热时长
+    int sample_ms;        // 单次采样的目标时长（用于自动确定批大小）
+    int latency_ops;      // 延迟场景中每个线程记录的操作数
+    bool pin;             // 是否把线程绑定到固定 CPU
+    int cpu;              // 主线程绑定的 CPU，-1 表示取第一个可用 CPU
+    bool json;            // 输出 JSON 而不是文本表格
+    std::string json_path; // JSON 输出文件，为空时写到标准输出
+    std::string filter;   // 只运行名称包含该子串的场景
+};
+
+// 单个场景的统计结果：吞吐场景为每次采样的 ns/op，延迟场景为单次操作的 ns
+struct BenchResult
+{
+    std::string name;
+    bool latency;         // 是否为逐次计时的延迟分布
+    std::size_t batch;    // 每次采样执行的操作数（延迟场景为每线程记录数）
+    std::size_t threads;  // 参与计时的线程数
+    double median;
+    double mean;
+    double p99;
+    double p999;
+    double min;
+    double max;
+    double stddev;
+    std::vector<double> samples;
+    std::vector<std::pair<std::string, double>> counters; // 场景附加的计数（如 allocs/op）
+};
+
+namespace bench_detail {
+
+// 可用 CPU 列表；不支持绑定的平台返回空
+inline std::vector<int> allowed_cpus()
+{
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        for (int i = 0; i < CPU_SETSIZE; ++i)
+        {
+            if (CPU_ISSET(i, &set))
+                cpus.push_back(i);
+        }
+    }
+#endif
+    return cpus;
+}
+
+// 把调用线程绑定到指定 CPU，失败或不支持时返回 false
+inline bool pin_this_thread(int cpu)
+{
+#if defined(__linux__)
+    if (cpu < 0)
+        return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+// 最近秩法求百分位，samples 必须已排序
+inline double percentile(const std::vector<double> &sorted, double p)
+{
+    if (sorted.empty())
+        return 0.0;
+    std::size_t rank = static_cast<std::size_t>(std::ceil(p / 100.0 * sorted.size()));
+    if (rank == 0)
+        rank = 1;
+    return sorted[std::min(rank, sorted.size()) - 1];
+}
+
+inline std::string json_escape(const std::string &s)
+{
+    std::string out;
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+} // namespace bench_detail
+
+// 场景上下文：负责预热、确定批大小与采样
+class BenchState
+{
+public:
+    typedef std::chrono::steady_clock clock;
+
+    BenchState(const BenchOptions &options, const std::vector<int> &cpus)
+        : options_(options), cpus_(cpus), batch_(0), threads_(1), latency_(false)
+    {
+    }
+
+    // 登记后台负载：run_latency 期间 threads 个线程反复调用 fn()，不计时
+    template <typename Fn>
+    void background(std::size_t threads, Fn fn)
+    {
+        background_.push_back(std::make_pair(threads, std::function<void()>(fn)));
+    }
+
+    // 延迟分布：threads 个线程各自预热后逐次计时 latency_ops 次 op(index)，
+    // 同时运行已登记的后台负载；结果为所有单次操作耗时（ns）
+    template <typename Op>
+    void run_latency(std::size_t threads, Op op)
+    {
+        if (threads == 0)
+            threads = 1;
+        threads_ = threads;
+        latency_ = true;
+        batch_ = static_cast<std::size_t>(options_.latency_ops);
+        samples_.clear();
+
+        std::vector<std::vector<double>> per_thread(threads);
+        std::atomic<bool> stop{false};
+        std::atomic<std::size_t> ready{0};
+        std::atomic<bool> go{false};
+        std::vector<std::thread> workers;
+        std::size_t slot = 1; // 主线程占用第一个 CPU
+
+        auto next_cpu = [&]() -> int {
+            if (!options_.pin || cpus_.size() < 2)
+                return -1;
+            return cpus_[slot++ % cpus_.size()];
+        };
+
+        std::size_t background_threads = 0;
+        for (const auto &b : background_)
+        {
+            for (std::size_t i = 0; i < b.first; ++i, ++background_threads)
+            {
+                const std::function<void()> &fn = b.second;
+                int cpu = next_cpu();
+                workers.emplace_back([&fn, &stop, &ready, &go, cpu]() {
+                    bench_detail::pin_this_thread(cpu);
+                    ready.fetch_add(1);
+                    while (!go.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                    while (!stop.load(std::memory_order_relaxed))
+                        fn();
+                });
+            }
+        }
+
+        std::atomic<std::size_t> finished{0};
+        const std::size_t count = batch_;
+        const auto warmup = std::chrono::milliseconds(options_.warmup_ms);
+        for (std::size_t t = 0; t < threads; ++t)
+        {
+            int cpu = next_cpu();
+            std::vector<double> &out = per_thread[t];
+            workers.emplace_back([&op, &out, &ready, &go, &finished, t, cpu, count, warmup]() {
+                bench_detail::pin_this_thread(cpu);
+                out.reserve(count);
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+
+                auto warm_until = clock::now() + warmup;
+                while (clock::now() < warm_until)
+                    op(t);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    auto start = clock::now();
+                    op(t);
+                    auto end = clock::now();
+                    out.push_back(static_cast<double>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+                }
+                finished.fetch_add(1);
+            });
+        }
+
+        while (ready.load() < threads + background_threads)
+            std::this_thread::yield();
+        go.store(true, std::memory_order_release);
+        while (finished.load() < threads)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        stop.store(true);
+        for (auto &w : workers)
+            w.join();
+
+        samples_.reserve(threads * count);
+        for (const auto &v : per_thread)
+            samples_.insert(samples_.end(), v.begin(), v.end());
+    }
+
+    // 单线程计时：每次采样调用 op() batch 次
+    template <typename Op>
+    void run(Op op)
+    {
+        threads_ = 1;
+        measure([&op](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                op();
+        });
+    }
+
+    // 批量计时：body(n) 自行执行 n 次操作，适合需要在批内维护状态的场景
+    template <typename Body>
+    void run_batch(Body body)
+    {
+        threads_ = 1;
+        measure(body);
+    }
+
+    // 多线程计时：threads 个常驻工作线程各调用 op(index) batch 次，
+    // 结果为墙钟时间除以总操作数
+    template <typename Op>
+    void run_parallel(std::size_t threads, Op op)
+    {
+        if (threads == 0)
+            threads = 1;
+        threads_ = threads;
+
+        parallel_pool pool(threads, cpus_, options_.pin,
+                           std::function<void(std::size_t, std::size_t)>(
+                               [&op](std::size_t index, std::size_t n) {
+                                   for (std::size_t i = 0; i < n; ++i)
+                                       op(index);
+                               }));
+        measure([&pool](std::size_t n) { pool.run(n); });
+    }
+
+    // 附加一个与计时一起报告的计数
+    void counter(const std::string &name, double value)
+    {
+        counters_.push_back(std::make_pair(name, value));
+    }
+
+    const std::vector<double> &samples() const { return samples_; }
+    const std::vector<std::pair<std::string, double>> &counters() const { return counters_; }
+    std::size_t batch() const { return batch_; }
+    std::size_t threads() const { return threads_; }
+    bool latency() const { return latency_; }
+
+private:
+    // 常驻工作线程：每轮由 run(n) 放行，全部完成后返回，避免把线程创建计入采样
+    class parallel_pool
+    {
+    public:
+        parallel_pool(std::size_t threads, const std::vector<int> &cpus, bool pin,
+                      std::function<void(std::size_t, std::size_t)> body)
+            : body_(std::move(body)), round_(0), batch_(0), remaining_(0), stop_(false)
+        {
+            for (std::size_t i = 0; i < threads; ++i)
+            {
+                // 主线程占用第一个 CPU，工作线程依次使用其余 CPU
+                int cpu = (pin && cpus.size() > 1) ? cpus[(i + 1) % cpus.size()] : -1;
+                workers_.emplace_back([this, i, cpu]() { worker(i, cpu); });
+            }
+        }
+
+        ~parallel_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lk(mutex_);
+                stop_ = true;
+            }
+            start_.notify_all();
+            for (auto &t : workers_)
+                t.join();
+        }
+
+        void run(std::size_t n)
+        {
+            std::unique_lock<std::mutex> lk(mutex_);
+            batch_ = n;
+            remaining_ = workers_.size();
+            ++round_;
+            start_.notify_all();
+            done_.wait(lk, [this]() { return remaining_ == 0; });
+        }
+
+    private:
+        void worker(std::size_t index, int cpu)
+        {
+            bench_detail::pin_this_thread(cpu);
+            std::size_t seen = 0;
+            for (;;)
+            {
+                std::size_t n;
+                {
+                    std::unique_lock<std::mutex> lk(mutex_);
+                    start_.wait(lk, [&]() { return stop_ || round_ != seen; });
+                    if (stop_)
+                        return;
+                    seen = round_;
+                    n = batch_;
+                }
+                body_(index, n);
+                std::lock_guard<std::mutex> lk(mutex_);
+                if (--remaining_ == 0)
+                    done_.notify_one();
+            }
+        }
+
+        std::function<void(std::size_t, std::size_t)> body_;
+        std::vector<std::thread> workers_;
+        std::mutex mutex_;
+        std::condition_variable start_;
+        std::condition_variable done_;
+        std::size_t round_;
+        std::size_t batch_;
+        std::size_t remaining_;
+        bool stop_;
+    };
+
+    template <typename Body>
+    static double time_batch(Body &body, std::size_t n)
+    {
+        auto start = clock::now();
+        body(n);
+        auto end = clock::now();
+        return static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    template <typename Body>
+    void measure(Body body)
+    {
+        samples_.clear();
+
+        // 预热并确定批大小：倍增直到单批耗时达到 sample_ms
+        const double target = options_.sample_ms * 1e6;
+        std::size_t n = 1;
+        double elapsed = time_batch(body, n);
+        while (elapsed < target && n < (std::size_t(1) << 30))
+        {
+            n = elapsed > 0 ? std::max<std::size_t>(n * 2, static_cast<std::size_t>(n * target / elapsed / 2))
+                            : n * 2;
+            elapsed = time_batch(body, n);
+        }
+        batch_ = n;
+
+        auto warm_until = clock::now() + std::chrono::milliseconds(options_.warmup_ms);
+        while (clock::now() < warm_until)
+            time_batch(body, n);
+
+        for (int r = 0; r < options_.repeats; ++r)
+            samples_.push_back(time_batch(body, n) / (static_cast<double>(n) * threads_));
+    }
+
+    const BenchOptions &options_;
+    const std::vector<int> &cpus_;
+    std::vector<double> samples_;
+    std::size_t batch_;
+    std::size_t threads_;
+    bool latency_;
+    std::vector<std::pair<std::size_t, std::function<void()>>> background_;
+    std::vector<std::pair<std::string, double>> counters_;
+};
+
+// 基准运行器
+class BenchRunner
+{
+public:
+    typedef void (*BenchFunc)(BenchState &);
+
+    static BenchRunner &instance()
+    {
+        static BenchRunner runner;
+        return runner;
+    }
+
+    void add(const std::string &name, BenchFunc func)
+    {
+        cases_.push_back({name, func});
+    }
+
+    void list(std::ostream &os) const
+    {
+        for (const auto &c : cases_)
+            os << c.name << "\n";
+    }
+
+    int run(const BenchOptions &options)
+    {
+        std::vector<int> cpus = bench_detail::allowed_cpus();
+        bool pinned = false;
+        if (options.pin && !cpus.empty())
+        {
+            int cpu = options.cpu >= 0 ? options.cpu : cpus.front();
+            pinned = bench_detail::pin_this_thread(cpu);
+            // 主线程绑定的 CPU 放到首位，工作线程从其后依次分配
+            auto it = std::find(cpus.begin(), cpus.end(), cpu);
+            if (it != cpus.end())
+                std::rotate(cpus.begin(), it, cpus.end());
+        }
+
+        std::vector<BenchResult> results;
+        for (const auto &c : cases_)
+        {
+            if (!options.filter.empty() && c.name.find(options.filter) == std::string::npos)
+                continue;
+
+            BenchState state(options, cpus);
+            c.func(state);
+            if (state.samples().empty())
+                continue;
+
+            results.push_back(summarize(c.name, state));
+            if (!options.json)
+                print_text(std::cout, results.back(), results.size() == 1);
+        }
+
+        if (options.json)
+        {
+            if (options.json_path.empty())
+            {
+                print_json(std::cout, results, options, pinned);
+            }
+            else
+            {
+                std::FILE *f = std::fopen(options.json_path.c_str(), "w");
+                if (!f)
+                {
+                    std::cerr << "cannot open " << options.json_path << "\n";
+                    return 1;
+                }
+                std::ostringstream oss;
+                print_json(oss, results, options, pinned);
+                std::fputs(oss.str().c_str(), f);
+                std::fclose(f);
+            }
+        }
+        return 0;
+    }
+
+private:
+    struct BenchCase
+    {
+        std::string name;
+        BenchFunc func;
+    };
+
+    static BenchResult summarize(const std::string &name, const BenchState &state)
+    {
+        BenchResult r;
+        r.name = name;
+        r.latency = state.latency();
+        r.batch = state.batch();
+        r.threads = state.threads();
+        r.samples = state.samples();
+        r.counters = state.counters();
+
+        std::vector<double> sorted(r.samples);
+        std::sort(sorted.begin(), sorted.end());
+
+        double sum = 0.0;
+        for (double v : sorted)
+            sum += v;
+        r.mean = sum / sorted.size();
+
+        double var = 0.0;
+        for (double v : sorted)
+            var += (v - r.mean) * (v - r.mean);
+        r.stddev = sorted.size() > 1 ? std::sqrt(var / (sorted.size() - 1)) : 0.0;
+
+        r.median = bench_detail::percentile(sorted, 50.0);
+        r.p99 = bench_detail::percentile(sorted, 99.0);
+        r.p999 = bench_detail::percentile(sorted, 99.9);
+        r.min = sorted.front();
+        r.max = sorted.back();
+        return r;
+    }
+
+    static void print_text(std::ostream &os, const BenchResult &r, bool header)
+    {
+        char line[256];
+        if (header)
+        {
+            std::snprintf(line, sizeof(line), "%-44s %8s %12s %12s %12s %12s %10s\n",
+                          "benchmark (ns)", "threads", "median", "p99", "p999", "min", "stddev");
+            os << line << std::string(116, '-') << "\n";
+        }
+        std::snprintf(line, sizeof(line), "%-44s %8zu %12.2f %12.2f %12.2f %12.2f %10.2f\n",
+                      r.name.c_str(), r.threads, r.median, r.p99, r.p999, r.min, r.stddev);
+        os << line;
+        for (const auto &c : r.counters)
+        {
+            std::snprintf(line, sizeof(line), "    %-40s %12.2f\n", c.first.c_str(), c.second);
+            os << line;
+        }
+        os << std::flush;
+    }
+
+    static void print_json(std::ostream &os, const std::vector<BenchResult> &results,
+                           const BenchOptions &options, bool pinned)
+    {
+        os << "{\n  \"context\": {\"repeats\": " << options.repeats
+           << ", \"warmup_ms\": " << options.warmup_ms
+           << ", \"sample_ms\": " << options.sample_ms
+           << ", \"latency_ops\": " << options.latency_ops
+           << ", \"pinned\": " << (pinned ? "true" : "false")
+           << ", \"hardware_concurrency\": " << std::thread::hardware_concurrency()
+           << "},\n  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const BenchResult &r = results[i];
+            os << (i ? ",\n" : "\n") << "    {\"name\": \"" << bench_detail::json_escape(r.name)
+               << "\", \"kind\": \"" << (r.latency ? "latency" : "throughput")
+               << "\", \"unit\": \"" << (r.latency ? "ns" : "ns/op")
+               << "\", \"threads\": " << r.threads
+               << ", \"batch\": " << r.batch
+               << ", \"median\": " << r.median << ", \"mean\": " << r.mean
+               << ", \"p99\": " << r.p99 << ", \"p999\": " << r.p999
+               << ", \"min\": " << r.min
+               << ", \"max\": " << r.max << ", \"stddev\": " << r.stddev;
+            if (!r.counters.empty())
+            {
+                os << ", \"counters\": {";
+                for (std::size_t k = 0; k < r.counters.size(); ++k)
+                    os << (k ? ", " : "") << "\"" << bench_detail::json_escape(r.counters[k].first)
+                       << "\": " << r.counters[k].second;
+                os << "}";
+            }
+            // 延迟场景的逐次样本数量很大，只输出统计值
+            if (!r.latency)
+            {
+                os << ", \"samples\": [";
+                for (std::size_t k = 0; k < r.samples.size(); ++k)
+                    os << (k ? ", " : "") << r.samples[k];
+                os << "]";
+            }
+            os << "}";
+        }
+        os << "\n  ]\n}\n";
+    }
+
+    std::vector<BenchCase> cases_;
+};
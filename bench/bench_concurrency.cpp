@@ -0,0 +1,58 @@
+#include "bench_common.hpp"
+
+// 多线程并发发射同一信号，结果为墙钟时间 / 总发射次数
+static void emit_parallel(BenchState &state, std::size_t threads)
+{
+    xswl::signal_t<int> sig;
+    std::atomic<long> sink{0};
+    for (int i = 0; i < 4; ++i)
+        sig.connect([&sink](int v) { sink.fetch_add(v, std::memory_order_relaxed); });
+    state.run_parallel(threads, [&](std::size_t) { sig(1); });
+}
+
+BENCH_CASE(concurrent_emit_2_threads)
+{
+    emit_parallel(state, 2);
+}
+
+BENCH_CASE(concurrent_emit_4_threads)
+{
+    emit_parallel(state, 4);
+}
+
+BENCH_CASE(concurrent_emit_8_threads)
+{
+    emit_parallel(state, 8);
+}
+
+// 各线程发射各自的信号：衡量没有共享状态时的扩展性
+BENCH_CASE(independent_emit_4_threads)
+{
+    std::vector<std::unique_ptr<xswl::signal_t<int>>> sigs;
+    for (int i = 0; i < 4; ++i)
+    {
+        sigs.emplace_back(new xswl::signal_t<int>());
+        sigs.back()->connect([](int v) { bench_keep(v); });
+    }
+    state.run_parallel(4, [&](std::size_t index) { (*sigs[index])(1); });
+}
+
+// 发射线程与连接/断开线程混合：线程 0 不断连接断开，其余线程发射
+BENCH_CASE(emit_with_connect_churn_4_threads)
+{
+    xswl::signal_t<int> sig;
+    std::atomic<long> sink{0};
+    for (int i = 0; i < 8; ++i)
+        sig.connect([&sink](int v) { sink.fetch_add(v, std::memory_order_relaxed); });
+    state.run_parallel(4, [&](std::size_t index) {
+        if (index == 0)
+        {
+            auto conn = sig.connect([](int) {});
+            conn.disconnect();
+        }
+        else
+        {
+            sig(1);
+        }
+    });
+}
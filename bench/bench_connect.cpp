@@ -0,0 +1,85 @@
+#include "bench_common.hpp"
+
+// 连接后立即断开（信号上没有其他槽）
+BENCH_CASE(connect_disconnect)
+{
+    xswl::signal_t<int> sig;
+    state.run([&]() {
+        auto conn = sig.connect([](int) {});
+        conn.disconnect();
+    });
+}
+
+// 信号上已有 100 个槽时的连接与断开
+BENCH_CASE(connect_disconnect_100_existing)
+{
+    xswl::signal_t<int> sig;
+    for (int i = 0; i < 100; ++i)
+        sig.connect([](int) {}, i);
+    state.run([&]() {
+        auto conn = sig.connect([](int) {}, 50);
+        conn.disconnect();
+    });
+}
+
+// 批量连接后批量断开，按单次连接计
+BENCH_CASE(connect_batch_then_disconnect_all)
+{
+    xswl::signal_t<int> sig;
+    std::vector<xswl::connection_t<int>> conns;
+    state.run_batch([&](std::size_t n) {
+        conns.clear();
+        conns.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+            conns.push_back(sig.connect([](int) {}));
+        sig.disconnect_all();
+    });
+}
+
+// 单次连接：连接后发射一次即自动断开
+BENCH_CASE(connect_once_emit)
+{
+    xswl::signal_t<int> sig;
+    state.run([&]() {
+        sig.connect_once([](int) {});
+        sig(1);
+    });
+}
+
+// 跟踪对象的成员函数连接与断开
+BENCH_CASE(connect_tracked_disconnect)
+{
+    struct Obj
+    {
+        void on(int) {}
+    };
+    auto obj = std::make_shared<Obj>();
+    xswl::signal_t<int> sig;
+    state.run([&]() {
+        auto conn = sig.connect(obj, &Obj::on);
+        conn.disconnect();
+    });
+}
+
+// 标签连接、发射一次后按标签断开
+// 按标签断开只做标记，槽在下一次发射时才被清理，因此每轮都发射一次以保持槽表大小稳定
+BENCH_CASE(connect_tag_emit_disconnect_tag)
+{
+    xswl::signal_t<int> sig;
+    const std::string tag("bench");
+    state.run([&]() {
+        sig.connect(tag, [](int) {});
+        sig(1);
+        sig.disconnect(tag);
+    });
+}
+
+// 作用域连接：析构时自动断开
+BENCH_CASE(scoped_connection)
+{
+    xswl::signal_t<int> sig;
+    state.run([&]() {
+        xswl::scoped_connection_t scoped = sig.connect([](int) {});
+        bench_keep(scoped);
+    });
+}
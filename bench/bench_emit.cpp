@@ -0,0 +1,132 @@
+#include "bench_common.hpp"
+
+// 空信号发射：测量没有槽时的基线开销
+BENCH_CASE(emit_empty)
+{
+    xswl::signal_t<int> sig;
+    int v = 0;
+    state.run([&]() { sig(++v); });
+}
+
+// 单个 lambda 槽
+BENCH_CASE(emit_1_slot)
+{
+    xswl::signal_t<int> sig;
+    int sink = 0;
+    sig.connect([&sink](int v) { sink += v; });
+    state.run([&]() { sig(1); });
+    bench_keep(sink);
+}
+
+// 扇出：10 与 100 个槽
+static void emit_fanout(BenchState &state, int slots)
+{
+    xswl::signal_t<int> sig;
+    int sink = 0;
+    for (int i = 0; i < slots; ++i)
+        sig.connect([&sink](int v) { sink += v; });
+    state.run([&]() { sig(1); });
+    bench_keep(sink);
+}
+
+BENCH_CASE(emit_10_slots)
+{
+    emit_fanout(state, 10);
+}
+
+BENCH_CASE(emit_100_slots)
+{
+    emit_fanout(state, 100);
+}
+
+// 开启槽调用统计：每个槽多两次时钟读取与若干 relaxed 原子操作
+BENCH_CASE(emit_10_slots_stats)
+{
+    xswl::signal_t<int> sig;
+    sig.enable_stats();
+    int sink = 0;
+    for (int i = 0; i < 10; ++i)
+        sig.connect([&sink](int v) { sink += v; });
+    state.run([&]() { sig(1); });
+    bench_keep(sink);
+}
+
+// 开启 1/1000 采样剖析：未被采样的发射只多一次线程本地递减
+BENCH_CASE(emit_10_slots_sampled)
+{
+    xswl::signal_t<int> sig;
+    int sink = 0;
+    for (int i = 0; i < 10; ++i)
+        sig.connect([&sink](int v) { sink += v; });
+    xswl::profiler::start(1000);
+    state.run([&]() { sig(1); });
+    xswl::profiler::stop();
+    bench_keep(sink);
+}
+
+// 不同优先级的槽（按优先级排序后的发射路径）
+BENCH_CASE(emit_10_slots_prioritized)
+{
+    xswl::signal_t<int> sig;
+    int sink = 0;
+    for (int i = 0; i < 10; ++i)
+        sig.connect([&sink](int v) { sink += v; }, i * 7 % 10);
+    state.run([&]() { sig(1); });
+    bench_keep(sink);
+}
+
+// 跟踪槽：shared_ptr 成员函数，每次发射需 lock 弱引用
+BENCH_CASE(emit_tracked_member)
+{
+    struct Obj
+    {
+        int sink = 0;
+        void on(int v) { sink += v; }
+    };
+    auto obj = std::make_shared<Obj>();
+    xswl::signal_t<int> sig;
+    sig.connect(obj, &Obj::on);
+    state.run([&]() { sig(1); });
+    bench_keep(obj->sink);
+}
+
+// 10 个跟踪槽
+BENCH_CASE(emit_tracked_10_slots)
+{
+    struct Obj
+    {
+        int sink = 0;
+        void on(int v) { sink += v; }
+    };
+    std::vector<std::shared_ptr<Obj>> objs;
+    xswl::signal_t<int> sig;
+    for (int i = 0; i < 10; ++i)
+    {
+        objs.push_back(std::make_shared<Obj>());
+        sig.connect(objs.back(), &Obj::on);
+    }
+    state.run([&]() { sig(1); });
+    bench_keep(objs.front()->sink);
+}
+
+// 标签槽：标签连接在发射路径上与跟踪槽相同
+BENCH_CASE(emit_tagged_10_slots)
+{
+    xswl::signal_t<int> sig;
+    int sink = 0;
+    for (int i = 0; i < 10; ++i)
+        sig.connect("tag" + std::to_string(i), [&sink](int v) { sink += v; });
+    state.run([&]() { sig(1); });
+    bench_keep(sink);
+}
+
+// 非平凡参数：按 const 引用传递 std::string
+BENCH_CASE(emit_string_arg)
+{
+    xswl::signal_t<std::string> sig;
+    std::size_t sink = 0;
+    sig.connect([&sink](const std::string &s) { sink += s.size(); });
+    const std::string payload(64, 'x');
+    state.run([&]() { sig(payload); });
+    bench_keep(sink);
+}
@@ -0,0 +1,113 @@
+#include "bench_common.hpp"
+
+// 单次发射延迟分布：threads 个发射线程共享同一信号，可选一个后台线程不断连接/断开
+static void emit_latency(BenchState &state, std::size_t threads, bool churn)
+{
+    xswl::signal_t<int> sig;
+    std::atomic<long> sink{0};
+    for (int i = 0; i < 8; ++i)
+        sig.connect([&sink](int v) { sink.fetch_add(v, std::memory_order_relaxed); });
+
+    if (churn)
+    {
+        state.background(1, [&sig]() {
+            auto conn = sig.connect([](int) {});
+            conn.disconnect();
+        });
+    }
+    state.run_latency(threads, [&sig](std::size_t) { sig(1); });
+}
+
+#define EMIT_LATENCY_CASES(n) \
+    BENCH_CASE(emit_latency_##n##_threads) { emit_latency(state, n, false); } \
+    BENCH_CASE(emit_latency_##n##_threads_churn) { emit_latency(state, n, true); }
+
+EMIT_LATENCY_CASES(1)
+EMIT_LATENCY_CASES(2)
+EMIT_LATENCY_CASES(4)
+EMIT_LATENCY_CASES(8)
+EMIT_LATENCY_CASES(16)
+EMIT_LATENCY_CASES(32)
+EMIT_LATENCY_CASES(64)
+
+#undef EMIT_LATENCY_CASES
+
+// 读写混合：读者调用只读查询（同样需要获取信号互斥量），写者不断连接/断开。
+// 断开只做标记，槽在下一次发射时才被清理，因此写者每轮发射一次以保持槽表大小稳定
+static void reader_writer_latency(BenchState &state, std::size_t readers, std::size_t writers)
+{
+    xswl::signal_t<int> sig;
+    for (int i = 0; i < 32; ++i)
+        sig.connect([](int) {});
+
+    state.background(writers, [&sig]() {
+        auto conn = sig.connect([](int) {});
+        conn.disconnect();
+        sig(0);
+    });
+    state.run_latency(readers, [&sig](std::size_t) { bench_keep(sig.slot_count()); });
+}
+
+BENCH_CASE(rw_slot_count_latency_4_readers_1_writer)
+{
+    reader_writer_latency(state, 4, 1);
+}
+
+BENCH_CASE(rw_slot_count_latency_16_readers_4_writers)
+{
+    reader_writer_latency(state, 16, 4);
+}
+
+// 写者视角：发射线程持续运行时连接+断开一次的延迟
+static void writer_latency_under_emit(BenchState &state, std::size_t emitters)
+{
+    xswl::signal_t<int> sig;
+    for (int i = 0; i < 32; ++i)
+        sig.connect([](int v) { bench_keep(v); });
+
+    state.background(emitters, [&sig]() { sig(1); });
+    state.run_latency(1, [&sig](std::size_t) {
+        auto conn = sig.connect([](int) {});
+        conn.disconnect();
+    });
+}
+
+BENCH_CASE(connect_latency_under_4_emitters)
+{
+    writer_latency_under_emit(state, 4);
+}
+
+BENCH_CASE(connect_latency_under_16_emitters)
+{
+    writer_latency_under_emit(state, 16);
+}
+
+// 快照：发射时在锁内复制槽表，扇出越大持锁越久，并发发射与连接更容易排队
+static void snapshot_latency(BenchState &state, std::size_t threads, int slots)
+{
+    xswl::signal_t<int> sig;
+    std::atomic<long> sink{0};
+    for (int i = 0; i < slots; ++i)
+        sig.connect([&sink](int v) { sink.fetch_add(v, std::memory_order_relaxed); });
+
+    state.background(1, [&sig]() {
+        auto conn = sig.connect([](int) {});
+        conn.disconnect();
+    });
+    state.run_latency(threads, [&sig](std::size_t) { sig(1); });
+}
+
+BENCH_CASE(snapshot_100_slots_latency_4_threads_churn)
+{
+    snapshot_latency(state, 4, 100);
+}
+
+BENCH_CASE(snapshot_1000_slots_latency_4_threads_churn)
+{
+    snapshot_latency(state, 4, 1000);
+}
+
+BENCH_CASE(snapshot_100_slots_latency_16_threads_churn)
+{
+    snapshot_latency(state, 16, 100);
+}
@@ -0,0 +1,56 @@
+#include "bench_common.hpp"
+
+static void print_usage(const char *prog)
+{
+    std::cout << "usage: " << prog << " [options]\n"
+              << "  --filter <substr>   only run benchmarks whose name contains substr\n"
+              << "  --repeats <n>       samples per benchmark (default 20)\n"
+              << "  --warmup-ms <n>     warmup time before sampling (default 50)\n"
+              << "  --sample-ms <n>     target duration of one sample (default 10)\n"
+              << "  --latency-ops <n>   timed operations per thread in latency benchmarks (default 20000)\n"
+              << "  --cpu <n>           pin the main thread to cpu n\n"
+              << "  --no-pin            do not pin threads to cpus\n"
+              << "  --json [file]       write JSON results to file or stdout\n"
+              << "  --list              list benchmark names\n";
+}
+
+int main(int argc, char **argv)
+{
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool has_next = i + 1 < argc;
+        if (arg == "--filter" && has_next)
+            options.filter = argv[++i];
+        else if (arg == "--repeats" && has_next)
+            options.repeats = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup-ms" && has_next)
+            options.warmup_ms = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--sample-ms" && has_next)
+            options.sample_ms = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--latency-ops" && has_next)
+            options.latency_ops = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--cpu" && has_next)
+            options.cpu = std::atoi(argv[++i]);
+        else if (arg == "--no-pin")
+            options.pin = false;
+        else if (arg == "--json")
+        {
+            options.json = true;
+            if (has_next && argv[i + 1][0] != '-')
+                options.json_path = argv[++i];
+        }
+        else if (arg == "--list")
+        {
+            BenchRunner::instance().list(std::cout);
+            return 0;
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+    return BenchRunner::instance().run(options);
+}
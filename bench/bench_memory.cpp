@@ -0,0 +1,150 @@
+// 每种连接方式的内存占用：连接 N 个槽后用 memory_usage() 的差值折算每连接字节数
+#include "bench_common.hpp"
+
+namespace {
+
+struct Receiver
+{
+    int sink = 0;
+    void on(int v) { sink += v; }
+};
+
+} // namespace
+
+// connect(sig, i) 建立第 i 个连接；报告每连接字节数及分项，并计时连接+断开+发射一轮
+template <typename Connect>
+static void measure_footprint(BenchState &state, Connect connect)
+{
+    const std::size_t n = 1000;
+    xswl::signal_t<int> sig;
+    std::vector<xswl::connection_t<int>> conns;
+    conns.reserve(n);
+
+    xswl::memory_usage_t before = sig.memory_usage();
+    for (std::size_t i = 0; i < n; ++i)
+        conns.push_back(connect(sig, i));
+    xswl::memory_usage_t after = sig.memory_usage();
+
+    std::size_t per_conn = 0;
+    for (const auto &c : conns)
+        per_conn += c.memory_usage();
+
+    const double count = static_cast<double>(n);
+    state.counter("bytes/conn", static_cast<double>(after.total() - before.total()) / count);
+    state.counter("slot", static_cast<double>(after.slots - before.slots) / count);
+    state.counter("capture", static_cast<double>(after.captures - before.captures) / count);
+    state.counter("dispatcher", static_cast<double>(after.dispatchers - before.dispatchers) / count);
+    state.counter("tag", static_cast<double>(after.tags - before.tags) / count);
+    state.counter("container", static_cast<double>(after.containers - before.containers) / count);
+    state.counter("connection_t::memory_usage", static_cast<double>(per_conn) / count);
+
+    for (auto &c : conns)
+        c.disconnect();
+    sig(0);
+
+    std::size_t i = 0;
+    state.run([&]() {
+        auto c = connect(sig, i++ % n);
+        c.disconnect();
+        sig(0);
+    });
+}
+
+BENCH_CASE(memory_lambda_no_capture)
+{
+    measure_footprint(state, [](xswl::signal_t<int> &sig, std::size_t) {
+        return sig.connect([](int v) { bench_keep(v); });
+    });
+}
+
+BENCH_CASE(memory_lambda_capture_pointer)
+{
+    static int sink = 0;
+    measure_footprint(state, [](xswl::signal_t<int> &sig, std::size_t) {
+        int *p = &sink;
+        return sig.connect([p](int v) { *p += v; });
+    });
+}
+
+BENCH_CASE(memory_lambda_capture_64_bytes)
+{
+    measure_footprint(state, [](xswl::signal_t<int> &sig, std::size_t i) {
+        long payload[8] = {static_cast<long>(i)};
+        return sig.connect([payload](int v) { bench_keep(payload[0] + v); });
+    });
+}
+
+BENCH_CASE(memory_member_tracked)
+{
+    auto obj = std::make_shared<Receiver>();
+    measure_footprint(state, [obj](xswl::signal_t<int> &sig, std::size_t) {
+        return sig.connect(obj, &Receiver::on);
+    });
+}
+
+BENCH_CASE(memory_member_raw)
+{
+    static Receiver obj;
+    measure_footprint(state, [](xswl::signal_t<int> &sig, std::size_t) {
+        return sig.connect(&obj, &Receiver::on);
+    });
+}
+
+BENCH_CASE(memory_tagged_unique_tags)
+{
+    measure_footprint(state, [](xswl::signal_t<int> &sig, std::size_t i) {
+        return sig.connect("receiver-" + std::to_string(i), [](int v) { bench_keep(v); });
+    });
+}
+
+BENCH_CASE(memory_connect_once)
+{
+    measure_footprint(state, [](xswl::signal_t<int> &sig, std::size_t) {
+        return sig.connect_once([](int v) { bench_keep(v); });
+    });
+}
+
+BENCH_CASE(memory_queued)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    measure_footprint(state, [loop](xswl::signal_t<int> &sig, std::size_t) {
+        return sig.connect([](int v) { bench_keep(v); }, xswl::connect_options_t().queued(loop));
+    });
+    loop->drain();
+}
+
+BENCH_CASE(memory_coalesced)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    measure_footprint(state, [loop](xswl::signal_t<int> &sig, std::size_t) {
+        return sig.connect([](int v) { bench_keep(v); }, xswl::connect_options_t().coalesced(loop));
+    });
+    loop->drain();
+}
+
+BENCH_CASE(memory_throttled)
+{
+    measure_footprint(state, [](xswl::signal_t<int> &sig, std::size_t) {
+        return sig.connect([](int v) { bench_keep(v); },
+                           xswl::connect_options_t().throttle(std::chrono::milliseconds(10)));
+    });
+}
+
+BENCH_CASE(memory_budget_offload)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    measure_footprint(state, [loop](xswl::signal_t<int> &sig, std::size_t) {
+        return sig.connect([](int v) { bench_keep(v); },
+                           xswl::connect_options_t()
+                               .budget(std::chrono::microseconds(100))
+                               .offload(loop));
+    });
+    loop->drain();
+}
+
+BENCH_CASE(memory_thread_affine)
+{
+    measure_footprint(state, [](xswl::signal_t<int> &sig, std::size_t) {
+        return sig.connect([](int v) { bench_keep(v); }, xswl::connect_options_t().thread_affine());
+    });
+}
@@ -2,7 +2,7 @@
 
 # 便捷编译脚本 - xswl-signals
 # 使用方法: ./build.sh [command] [options]
-# 命令: build, clean, rebuild, test, install, help
+# 命令: build, clean, rebuild, test, bench, bench-alloc, install, help
 
 set -e
 
@@ -42,6 +42,8 @@ xswl-signals 编译脚本
   clean       清空构建目录
   rebuild     重新编译项目
   test        运行测试
+  bench       以 Release 模式编译并运行基准 (其余参数传给基准程序)
+  bench-alloc 以 Release 模式编译并运行分配计数基准 (其余参数传给基准程序)
   install     安装到 $INSTALL_PREFIX
   help        显示此帮助信息
 
@@ -55,6 +57,8 @@ xswl-signals 编译脚本
   ./build.sh build --debug      # Debug 模式编译
   ./build.sh rebuild            # 清空并重新编译
   ./build.sh test               # 运行测试
+  ./build.sh bench --json out.json  # 运行基准并输出 JSON
+  ./build.sh bench-alloc            # 统计每次操作的分配次数与字节数
   ./build.sh build --install    # 编译并安装
 
 EOF
@@ -149,6 +153,25 @@ run_tests() {
     ctest --output-on-failure
 }
 
+# 运行基准（使用独立的 Release 构建目录，避免影响常规构建配置）
+# 第一个参数为基准目标名，其余参数传给基准程序
+run_bench() {
+    local target="$1"
+    shift
+    local bench_dir="${SCRIPT_DIR}/build-bench"
+
+    print_info "编译基准 (模式: Release)"
+    cmake -S "$SCRIPT_DIR" -B "$bench_dir" \
+          -DCMAKE_BUILD_TYPE=Release \
+          -DXSWL_SIGNALS_BUILD_BENCH=ON \
+          -DXSWL_SIGNALS_BUILD_TESTS=OFF \
+          -DXSWL_SIGNALS_BUILD_EXAMPLES=OFF > /dev/null
+    cmake --build "$bench_dir" --target "$target" --parallel "$(nproc)"
+
+    print_info "运行基准..."
+    "$bench_dir/bench/$target" "$@"
+}
+
 # 安装
 install() {
     if [ ! -f "$BUILD_DIR/CMakeCache.txt" ]; then
@@ -180,6 +203,12 @@ main() {
         test|tests)
             run_tests
             ;;
+        bench)
+            run_bench xswl_signals_bench "$@"
+            ;;
+        bench-alloc)
+            run_bench xswl_signals_bench_alloc "$@"
+            ;;
         install)
             install
             ;;
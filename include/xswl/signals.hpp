@@ -3,15 +3,59 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <future>
+#include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#if defined(__linux__)
+    #include <cerrno>
+    #include <climits>
+    #include <ctime>
+    #include <linux/futex.h>
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/syscall.h>
+    #include <system_error>
+    #include <unistd.h>
+#endif
+
+#if defined(XSWL_SIGNALS_DEBUG_NO_ALLOC)
+    #include <cstdio>
+    #include <cstdlib>
+    #include <new>
+#endif
+
+#if defined(XSWL_SIGNALS_TRACING)
+    #include <cstdio>
+#endif
+
+// USDT 探针（Linux systemtap sys/sdt.h）：由 CMake 选项 XSWL_SIGNALS_ENABLE_USDT 开启，
+// 探针提供者为 xswl_signals；未被 bpftrace/perf 附加时每个探针只是一条 nop 指令
+#if defined(XSWL_SIGNALS_USDT)
+    #include <sys/sdt.h>
+    #define XSWL_SIGNALS_PROBE2(name, a, b)    STAP_PROBE2(xswl_signals, name, a, b)
+    #define XSWL_SIGNALS_PROBE3(name, a, b, c) STAP_PROBE3(xswl_signals, name, a, b, c)
+#else
+    #define XSWL_SIGNALS_PROBE2(name, a, b)    (void)0
+    #define XSWL_SIGNALS_PROBE3(name, a, b, c) (void)0
+#endif
+
 #ifndef emit
     #define emit
 #endif
@@ -26,658 +70,4862 @@ class connection_t;
 
 class scoped_connection_t;
 class connection_group_t;
+class deferral_guard_t;
 
-namespace detail {
+template <typename... Args>
+class async_signal_queue_t;
 
 // ============================================================================
-// C++11 index_sequence 实现
+// 稳态发射零分配检查（调试模式，定义 XSWL_SIGNALS_DEBUG_NO_ALLOC 时启用）
+// 发射复用已有快照时，除槽函数与分发器之外的路径不应分配内存；
+// 在一个翻译单元中展开 XSWL_SIGNALS_DEFINE_CHECKED_NEW() 替换全局 operator new 后，
+// 违反时调用已安装的处理函数，未安装时打印并 abort
 // ============================================================================
-template <std::size_t... Is>
-struct index_sequence
-{
-};
+#if defined(XSWL_SIGNALS_DEBUG_NO_ALLOC)
 
-template <std::size_t N, std::size_t... Is>
-struct make_index_sequence_impl : make_index_sequence_impl<N - 1, N - 1, Is...>
+typedef void (*emit_alloc_handler_t)(std::size_t bytes);
+
+namespace detail {
+
+inline int &no_alloc_depth()
 {
-};
+    static thread_local int depth = 0;
+    return depth;
+}
 
-template <std::size_t... Is>
-struct make_index_sequence_impl<0, Is...>
+inline std::atomic<emit_alloc_handler_t> &emit_alloc_handler()
 {
-    typedef index_sequence<Is...> type;
-};
+    static std::atomic<emit_alloc_handler_t> handler{nullptr};
+    return handler;
+}
 
-template <std::size_t N>
-struct make_index_sequence
+// 标记当前线程进入稳态发射路径
+class no_alloc_scope
 {
-    typedef typename make_index_sequence_impl<N>::type type;
-};
+public:
+    no_alloc_scope() { ++no_alloc_depth(); }
+    ~no_alloc_scope() { --no_alloc_depth(); }
 
-// ============================================================================
-// 可调用性检测
-// ============================================================================
+    no_alloc_scope(const no_alloc_scope &)            = delete;
+    no_alloc_scope &operator=(const no_alloc_scope &) = delete;
+};
 
-// 检测 F 是否可以用 Args... 调用
-template <typename F, typename... Args>
-struct is_invocable
+// 临时允许分配：重建快照、调用槽函数或分发器
+class alloc_allowed_scope
 {
-private:
-    template <typename Fn>
-    static auto test(int)
-        -> decltype(std::declval<Fn>()(std::declval<Args>()...), std::true_type{});
+public:
+    alloc_allowed_scope()
+        : saved_(no_alloc_depth())
+    {
+        no_alloc_depth() = 0;
+    }
 
-    template <typename>
-    static std::false_type test(...);
+    ~alloc_allowed_scope() { no_alloc_depth() = saved_; }
 
-public:
-    static const bool value = decltype(test<F>(0))::value;
+    alloc_allowed_scope(const alloc_allowed_scope &)            = delete;
+    alloc_allowed_scope &operator=(const alloc_allowed_scope &) = delete;
+
+private:
+    int saved_;
 };
 
-// 检测 F 是否可以用 tuple 中前 N 个元素调用
-template <typename F, typename Tuple, typename Indices>
-struct is_invocable_with_n_impl;
+} // namespace detail
 
-template <typename F, typename Tuple, std::size_t... Is>
-struct is_invocable_with_n_impl<F, Tuple, index_sequence<Is...>>
+// 安装违反时的处理函数，返回旧的处理函数；传入 nullptr 恢复默认（打印并 abort）
+inline emit_alloc_handler_t set_emit_alloc_handler(emit_alloc_handler_t handler)
 {
-private:
-    template <typename Fn>
-    static auto test(int)
-        -> decltype(std::declval<Fn>()(
-                        std::declval<typename std::tuple_element<Is, Tuple>::type>()...),
-                    std::true_type{});
+    return detail::emit_alloc_handler().exchange(handler);
+}
 
-    template <typename>
-    static std::false_type test(...);
+// 由替换的 operator new 调用；当前线程不在稳态发射路径时只有一次线程局部读取
+inline void check_emit_allocation(std::size_t bytes)
+{
+    if(detail::no_alloc_depth() == 0)
+        return;
 
-public:
-    static const bool value = decltype(test<F>(0))::value;
-};
+    detail::alloc_allowed_scope allow; // 处理函数自身可以分配
+    if(emit_alloc_handler_t handler = detail::emit_alloc_handler().load())
+    {
+        handler(bytes);
+        return;
+    }
+    std::fprintf(stderr, "xswl::signals: steady-state emit allocated %lu bytes\n",
+                 static_cast<unsigned long>(bytes));
+    std::abort();
+}
 
-template <typename F, std::size_t N, typename... Args>
-struct is_invocable_with_n
-{
-    typedef std::tuple<Args...> tuple_type;
-    typedef typename make_index_sequence<N>::type indices;
-    static const bool value = is_invocable_with_n_impl<F, tuple_type, indices>::value;
-};
+    #define XSWL_SIGNALS_NO_ALLOC_SCOPE(name)    ::xswl::detail::no_alloc_scope name
+    #define XSWL_SIGNALS_ALLOW_ALLOC_SCOPE(name) ::xswl::detail::alloc_allowed_scope name
+
+// 在全局作用域、且只在一个翻译单元中展开
+    #define XSWL_SIGNALS_DEFINE_CHECKED_NEW()                         \
+        void *operator new(std::size_t n)                             \
+        {                                                             \
+            ::xswl::check_emit_allocation(n);                         \
+            void *p = std::malloc(n ? n : 1);                         \
+            if(!p)                                                    \
+                throw std::bad_alloc();                               \
+            return p;                                                 \
+        }                                                             \
+        void *operator new[](std::size_t n) { return ::operator new(n); } \
+        void operator delete(void *p) noexcept { std::free(p); }      \
+        void operator delete[](void *p) noexcept { std::free(p); }
+
+#else
+    #define XSWL_SIGNALS_NO_ALLOC_SCOPE(name)    (void)0
+    #define XSWL_SIGNALS_ALLOW_ALLOC_SCOPE(name) (void)0
+#endif
 
 // ============================================================================
-// 参数数量检测（找到最大可调用参数数量）
+// 执行器：排队投递的目标
 // ============================================================================
-template <typename F, std::size_t N, std::size_t Max, typename... Args>
-struct find_callable_arity_impl
+class executor_t
 {
-    static const std::size_t value =
-        is_invocable_with_n<F, N, Args...>::value
-            ? N
-            : find_callable_arity_impl<F, N - 1, Max, Args...>::value;
-};
+public:
+    virtual ~executor_t() {}
 
-template <typename F, std::size_t Max, typename... Args>
-struct find_callable_arity_impl<F, 0, Max, Args...>
-{
-    static const std::size_t value = is_invocable<F>::value ? 0 : Max + 1; // Max+1 表示无法调用
-};
+    // 提交一个任务；任务在执行器自己的上下文中运行
+    virtual void post(std::function<void()> task) = 0;
 
-template <typename F, typename... Args>
-struct callable_arity
-{
-    static const std::size_t max_args = sizeof...(Args);
-    static const std::size_t value =
-        find_callable_arity_impl<F, max_args, max_args, Args...>::value;
-    static const bool is_valid = (value <= max_args);
+    // 带优先级提交；不区分优先级的执行器按普通提交处理
+    virtual void post_prioritized(std::function<void()> task, int priority)
+    {
+        (void)priority;
+        post(std::move(task));
+    }
+
+    // 当前线程是否是执行本执行器任务的线程
+    virtual bool running_in_this_thread() const { return false; }
+
+    // 当前线程正在执行本执行器的任务，且在它返回前本执行器不会执行其他任务；
+    // 在这样的线程上等待本执行器腾出空间会死锁。串行执行器等同于 running_in_this_thread()
+    virtual bool stalled_by_this_thread() const { return running_in_this_thread(); }
+
+    // 提交当前任务未完成部分的续作；默认按普通带优先级提交处理
+    virtual void post_continuation(std::function<void()> task, int priority)
+    {
+        post_prioritized(std::move(task), priority);
+    }
 };
 
 // ============================================================================
-// 参数适配器：将信号参数适配为槽函数需要的参数数量（通用实现）
+// event_loop_t：由使用者线程主动 drain 的任务队列
+// 按优先级分车道，高优先级先执行；低优先级车道被连续跳过 aging 次后先执行一次
 // ============================================================================
-template <typename Fn, std::size_t N, typename Indices = typename make_index_sequence<N>::type>
-struct arg_adapter;
-
-template <typename Fn, std::size_t N, std::size_t... Is>
-struct arg_adapter<Fn, N, index_sequence<Is...>>
+class event_loop_t : public executor_t
 {
-    Fn fn;
-    explicit arg_adapter(Fn f)
-        : fn(std::move(f)) {}
+public:
+    // aging 为 0 时严格按优先级执行，低优先级任务可能一直等待
+    explicit event_loop_t(std::size_t aging = 32)
+        : aging_(aging)
+        , next_seq_(0)
+        , count_(0)
+    {
+    }
 
-    // 非 const 版本
-    template <typename... Args>
-    void operator()(Args &&... args)
+    event_loop_t(const event_loop_t &)            = delete;
+    event_loop_t &operator=(const event_loop_t &) = delete;
+
+    void post(std::function<void()> task) override
     {
-        fn(std::get<Is>(std::forward_as_tuple(std::forward<Args>(args)...))...);
+        post_prioritized(std::move(task), 0);
     }
 
-    // const 版本
-    template <typename... Args>
-    void operator()(Args &&... args) const
+    void post_prioritized(std::function<void()> task, int priority) override
     {
-        fn(std::get<Is>(std::forward_as_tuple(std::forward<Args>(args)...))...);
+        if(!task)
+            return;
+        std::lock_guard<std::mutex> lk(mutex_);
+        entry e = {next_seq_++, false, std::move(task)};
+        lanes_[priority].tasks.push_back(std::move(e));
+        ++count_;
     }
-};
 
-// 适配器工厂函数
-template <std::size_t N, typename Fn>
-arg_adapter<typename std::decay<Fn>::type, N> make_arg_adapter(Fn &&fn)
-{
-    return arg_adapter<typename std::decay<Fn>::type, N>(std::forward<Fn>(fn));
-}
+    // 在本循环的 drain() 中提交的续作沿用当前任务的序号，排在本车道中本次 drain 范围的末尾，
+    // 因此仍在同一次 drain 中执行，且不计入 max；不在 drain 中时按普通提交处理
+    void post_continuation(std::function<void()> task, int priority) override
+    {
+        if(!task)
+            return;
+        drain_scope *scope = drain_scope::find(this);
+        if(!scope)
+        {
+            post_prioritized(std::move(task), priority);
+            return;
+        }
 
-// ============================================================================
-// 成员函数参数数量萃取
-// ============================================================================
-template <typename T>
-struct member_function_arity;
+        std::lock_guard<std::mutex> lk(mutex_);
+        std::deque<entry> &tasks = lanes_[priority].tasks;
+        auto pos                 = tasks.end();
+        while(pos != tasks.begin() && (pos - 1)->seq >= scope->limit)
+            --pos;
+        entry e = {scope->seq, true, std::move(task)};
+        tasks.insert(pos, std::move(e));
+        ++count_;
+    }
 
-template <typename C, typename R>
-struct member_function_arity<R (C::*)()>
-{
-    static const std::size_t value = 0;
-};
+    // 执行至多 max 个任务，返回实际执行数量
+    // 只处理调用时已在队列中的任务及其续作，drain 期间新投递的任务留到下一次
+    virtual std::size_t drain(std::size_t max = (std::numeric_limits<std::size_t>::max)())
+    {
+        drain_scope scope(this);
+        std::size_t budget;
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            budget      = (std::min)(max, count_);
+            scope.limit = next_seq_;
+        }
 
-template <typename C, typename R>
-struct member_function_arity<R (C::*)() const>
-{
-    static const std::size_t value = 0;
-};
+        std::size_t done = 0;
+        for(;;)
+        {
+            entry e;
+            {
+                std::lock_guard<std::mutex> lk(mutex_);
+                if(!pop_next_locked(scope.limit, done < budget, e))
+                    break;
+            }
+            if(!e.continuation)
+                ++done;
+            scope.seq = e.seq;
 
-template <typename C, typename R, typename A1>
-struct member_function_arity<R (C::*)(A1)>
-{
-    static const std::size_t value = 1;
-};
+            try
+            {
+                e.task();
+            }
+            catch(...)
+            {
+                // 异常吞噬，与同步发射保持一致
+            }
+        }
+        return done;
+    }
 
-template <typename C, typename R, typename A1>
-struct member_function_arity<R (C::*)(A1) const>
-{
-    static const std::size_t value = 1;
-};
+    std::size_t pending() const
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return count_;
+    }
 
-template <typename C, typename R, typename A1, typename A2>
-struct member_function_arity<R (C::*)(A1, A2)>
-{
-    static const std::size_t value = 2;
-};
+    bool empty() const
+    {
+        return pending() == 0;
+    }
 
-template <typename C, typename R, typename A1, typename A2>
-struct member_function_arity<R (C::*)(A1, A2) const>
-{
-    static const std::size_t value = 2;
-};
+    // 当前线程是否正在执行本循环的 drain()（包括其中执行的任务）
+    bool running_in_this_thread() const override
+    {
+        return drain_scope::active(this);
+    }
 
-template <typename C, typename R, typename A1, typename A2, typename A3>
-struct member_function_arity<R (C::*)(A1, A2, A3)>
-{
-    static const std::size_t value = 3;
-};
+private:
+    // 线程本地的 drain 栈：只在 drain() 期间登记，支持在任务中嵌套 drain 其他循环
+    class drain_scope
+    {
+    public:
+        explicit drain_scope(const event_loop_t *loop)
+            : limit(0)
+            , seq(0)
+            , loop_(loop)
+            , outer_(top())
+        {
+            top() = this;
+        }
 
-template <typename C, typename R, typename A1, typename A2, typename A3>
-struct member_function_arity<R (C::*)(A1, A2, A3) const>
-{
-    static const std::size_t value = 3;
-};
+        ~drain_scope() { top() = outer_; }
 
-template <typename C, typename R, typename A1, typename A2, typename A3, typename A4>
-struct member_function_arity<R (C::*)(A1, A2, A3, A4)>
-{
-    static const std::size_t value = 4;
-};
+        // 当前线程上本循环最内层的 drain
+        static drain_scope *find(const event_loop_t *loop)
+        {
+            for(drain_scope *s = top(); s; s = s->outer_)
+            {
+                if(s->loop_ == loop)
+                    return s;
+            }
+            return nullptr;
+        }
 
-template <typename C, typename R, typename A1, typename A2, typename A3, typename A4>
-struct member_function_arity<R (C::*)(A1, A2, A3, A4) const>
-{
-    static const std::size_t value = 4;
-};
+        static bool active(const event_loop_t *loop)
+        {
+            return find(loop) != nullptr;
+        }
 
-template <typename C, typename R, typename A1, typename A2, typename A3, typename A4,
-          typename A5>
-struct member_function_arity<R (C::*)(A1, A2, A3, A4, A5)>
-{
-    static const std::size_t value = 5;
-};
+        drain_scope(const drain_scope &)            = delete;
+        drain_scope &operator=(const drain_scope &) = delete;
 
-template <typename C, typename R, typename A1, typename A2, typename A3, typename A4,
-          typename A5>
-struct member_function_arity<R (C::*)(A1, A2, A3, A4, A5) const>
-{
-    static const std::size_t value = 5;
-};
+        std::uint64_t limit; // 本次 drain 开始时的 next_seq_，序号不小于它的任务留到下一次
+        std::uint64_t seq;   // 正在执行的任务的序号
 
-template <typename C, typename R, typename A1, typename A2, typename A3, typename A4,
-          typename A5, typename A6>
-struct member_function_arity<R (C::*)(A1, A2, A3, A4, A5, A6)>
-{
-    static const std::size_t value = 6;
-};
+    private:
+        static drain_scope *&top()
+        {
+            static thread_local drain_scope *current = nullptr;
+            return current;
+        }
 
-template <typename C, typename R, typename A1, typename A2, typename A3, typename A4,
-          typename A5, typename A6>
-struct member_function_arity<R (C::*)(A1, A2, A3, A4, A5, A6) const>
-{
-    static const std::size_t value = 6;
-};
+        const event_loop_t *loop_;
+        drain_scope *outer_;
+    };
 
-// ============================================================================
-// 槽函数封装
-// ============================================================================
-template <typename... Args>
-struct slot
-{
-    using function_type = std::function<void(Args...)>;
+    struct entry
+    {
+        std::uint64_t seq;  // 全局提交序号，用于界定一次 drain 的范围
+        bool continuation;  // 是否为 drain 中提交的续作
+        std::function<void()> task;
+    };
 
-    function_type func;
-    int priority;
-    std::atomic<bool> blocked;         // 是否被 block
-    std::atomic<bool> pending_removal; // 是否等待删除
-    std::atomic<bool> executed;        // 用于单次槽的 CAS 控制
-    bool single_shot;                  // 是否一次性
-    std::weak_ptr<void> tracked;       // 跟踪的 owner/tag（生命周期控制）
-    bool tracked_set;                  // 是否曾经设置过 tracked
+    struct lane
+    {
+        lane()
+            : skipped(0)
+        {
+        }
 
-    slot(function_type f, int p, bool ss, std::weak_ptr<void> t, bool has_tracked)
-        : func(std::move(f))
-        , priority(p)
-        , blocked(false)
-        , pending_removal(false)
-        , executed(false)
-        , single_shot(ss)
-        , tracked(std::move(t))
-        , tracked_set(has_tracked)
+        std::deque<entry> tasks;
+        std::size_t skipped; // 有任务却被更高优先级车道抢先的次数
+    };
+
+    // 车道数量等于出现过的不同优先级数，通常很少，线性扫描即可
+    // fresh 为 false 时（max 已用完）只取续作
+    static bool eligible(const lane &l, std::uint64_t limit, bool fresh)
     {
+        return !l.tasks.empty() && l.tasks.front().seq < limit &&
+               (fresh || l.tasks.front().continuation);
     }
 
-    // 基础检查（不包含单次槽的执行状态）
-    // 优化：使用 relaxed 读取非关键标志，减少内存屏障开销
-    bool is_callable() const
+    bool pop_next_locked(std::uint64_t limit, bool fresh, entry &out)
     {
-        // 先检查快速路径：blocked 和 pending_removal 用 relaxed 读取
-        // 这些标志的精确同步不影响正确性，最多延迟一次调用
-        if(blocked.load(std::memory_order_relaxed) ||
-           pending_removal.load(std::memory_order_relaxed))
+        lane *chosen = nullptr;
+        for(auto &kv : lanes_)
+        {
+            lane &l = kv.second;
+            if(!eligible(l, limit, fresh))
+                continue;
+            if(!chosen)
+                chosen = &l;
+            if(aging_ != 0 && l.skipped >= aging_)
+            {
+                chosen = &l; // 老化：饥饿的车道先执行一次
+                break;
+            }
+        }
+        if(!chosen)
             return false;
 
-        if(tracked_set && tracked.expired())
-            return false;
+        for(auto &kv : lanes_)
+        {
+            lane &l = kv.second;
+            if(&l != chosen && eligible(l, limit, fresh))
+                ++l.skipped;
+        }
+        chosen->skipped = 0;
 
+        out = std::move(chosen->tasks.front());
+        chosen->tasks.pop_front();
+        --count_;
         return true;
     }
 
-    // 尝试获取执行权（用于单次槽的线程安全）
-    bool try_acquire_execution()
-    {
-        if(!single_shot)
-            return true;
-
-        bool expected = false;
-        return executed.compare_exchange_strong(expected, true,
-                                                std::memory_order_acq_rel,
-                                                std::memory_order_acquire);
-    }
-};
-
-// 成员函数指针检测
-template <typename T>
-struct is_member_function_pointer : std::false_type
-{
-};
-
-template <typename C, typename R, typename... A>
-struct is_member_function_pointer<R (C::*)(A...)> : std::true_type
-{
-};
-
-template <typename C, typename R, typename... A>
-struct is_member_function_pointer<R (C::*)(A...) const> : std::true_type
-{
-};
-
-struct connection_tag
-{
-    explicit connection_tag(std::string n)
-        : name(std::move(n)) {}
-    std::string name;
+    mutable std::mutex mutex_;
+    std::map<int, lane, std::greater<int>> lanes_; // 按优先级从高到低
+    std::size_t aging_;
+    std::uint64_t next_seq_;
+    std::size_t count_;
 };
 
+#if defined(__linux__)
 // ============================================================================
-// 信号内部实现（共享状态）
+// eventfd_loop_t：带 eventfd 唤醒描述符的事件循环，可直接注册到使用者的 epoll
+// 有待执行任务时 fd() 可读；drain() 清除可读状态，未执行完的任务会重新置位
 // ============================================================================
-template <typename... Args>
-class signal_impl
+class eventfd_loop_t : public event_loop_t
 {
 public:
-    using slot_type = slot<Args...>;
-    using slot_ptr  = std::shared_ptr<slot_type>;
-
-    std::mutex mutex_;
-    std::vector<slot_ptr> slots_;
-    std::vector<std::shared_ptr<connection_tag>> tags_;
-    bool dirty_ = false; // 是否需要清理 or 重排
-
-    void disconnect_slot(const slot_ptr &s)
+    explicit eventfd_loop_t(std::size_t aging = 32)
+        : event_loop_t(aging)
+        , fd_(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+        , armed_(false)
     {
-        if(!s)
-            return;
-        std::lock_guard<std::mutex> lk(mutex_);
-        s->pending_removal.store(true, std::memory_order_release);
-        dirty_ = true;
+        if(fd_ < 0)
+            throw std::system_error(errno, std::system_category(), "eventfd");
     }
 
-    void cleanup_slots_locked()
+    ~eventfd_loop_t()
     {
-        auto it = std::remove_if(
-            slots_.begin(), slots_.end(),
-            [](const slot_ptr &s) {
-                return !s || s->pending_removal.load(std::memory_order_acquire);
-            });
-        slots_.erase(it, slots_.end());
+        ::close(fd_);
     }
-};
-
-} // namespace detail
-
-// ============================================================================
-// 连接句柄
-// ============================================================================
-template <typename... Args>
-class connection_t
-{
-public:
-    using impl_type = detail::signal_impl<Args...>;
-    using slot_type = detail::slot<Args...>;
-
-    connection_t() = default;
 
-    connection_t(const std::shared_ptr<impl_type> &impl,
-                 const std::shared_ptr<slot_type> &s)
-        : impl_(impl)
-        , slot_(s)
+    // 只在“无任务 -> 有任务”时写一次 eventfd，高频投递不会逐个触发系统调用
+    void post(std::function<void()> task) override
     {
+        post_prioritized(std::move(task), 0);
     }
 
-    // 拷贝/移动：复制 weak_ptr 即可
-    connection_t(const connection_t &)            = default;
-    connection_t &operator=(const connection_t &) = default;
-    connection_t(connection_t &&)                 = default;
-    connection_t &operator=(connection_t &&)      = default;
-
-    // 是否仍然连接有效
-    bool is_connected() const
+    void post_prioritized(std::function<void()> task, int priority) override
     {
-        auto s = slot_.lock();
-        return s && !s->pending_removal.load(std::memory_order_acquire);
+        if(!task)
+            return;
+        event_loop_t::post_prioritized(std::move(task), priority);
+        arm();
     }
 
-    explicit operator bool() const { return is_connected(); }
-
-    // 主动断开
-    void disconnect()
+    std::size_t drain(std::size_t max = (std::numeric_limits<std::size_t>::max)()) override
     {
-        auto impl = impl_.lock();
-        auto s    = slot_.lock();
-        if(impl && s)
-        {
-            impl->disconnect_slot(s);
-        }
-        // 如果 impl 已销毁，则什么也不做（安全）
+        disarm();
+        std::size_t done = event_loop_t::drain(max);
+        if(!empty())
+            rearm();
+        return done;
     }
 
-    // 阻塞 / 解除阻塞
-    void block(bool b = true)
+    // 以 EPOLLIN 注册到 epoll；可读表示有待 drain 的任务
+    int fd() const { return fd_; }
+
+private:
+    void arm()
     {
-        if(auto s = slot_.lock())
-        {
-            s->blocked.store(b, std::memory_order_release);
-        }
+        if(armed_.exchange(true, std::memory_order_acq_rel))
+            return;
+        std::uint64_t one = 1;
+        ssize_t n         = ::write(fd_, &one, sizeof(one));
+        (void)n; // 计数器溢出前不会失败；EAGAIN 时 fd 本就可读
     }
 
-    void unblock() { block(false); }
-
-    bool is_blocked() const
+    // 不看 armed_ 直接置位：drain 后仍有任务时 fd 一定可读
+    void rearm()
     {
-        auto s = slot_.lock();
-        return s && s->blocked.load(std::memory_order_acquire);
+        armed_.store(true, std::memory_order_seq_cst);
+        std::uint64_t one = 1;
+        ssize_t n         = ::write(fd_, &one, sizeof(one));
+        (void)n;
     }
 
-    // 释放引用（不影响实际连接）
-    void reset()
+    void disarm()
     {
-        impl_.reset();
-        slot_.reset();
+        // 先读再清标志：清除之后的投递一定重新写入；读与清除之间的投递
+        // 看到旧标志而不写入，它的任务要么由本次 drain 执行，要么由 drain 结束时的 rearm() 覆盖
+        std::uint64_t value;
+        ssize_t n = ::read(fd_, &value, sizeof(value));
+        (void)n; // EAGAIN 表示当前不可读
+        armed_.store(false, std::memory_order_seq_cst);
     }
 
-private:
-    std::weak_ptr<impl_type> impl_;
-    std::weak_ptr<slot_type> slot_;
+    int fd_;
+    std::atomic<bool> armed_; // eventfd 是否已置位
 };
+#endif
 
 // ============================================================================
-// 信号类
+// thread_pool_t：固定数量工作线程的执行器
+// 队列状态由工作线程共同持有，线程池可以在自己的工作线程上析构
 // ============================================================================
-template <typename... Args>
-class signal_t
+class thread_pool_t : public executor_t
 {
 public:
-    using impl_type     = detail::signal_impl<Args...>;
-    using slot_type     = detail::slot<Args...>;
-    using function_type = typename slot_type::function_type;
-    using slot_ptr      = std::shared_ptr<slot_type>;
-
-    signal_t()
-        : impl_(std::make_shared<impl_type>())
+    // threads 为 0 时使用硬件并发数
+    explicit thread_pool_t(std::size_t threads = 0)
+        : state_(std::make_shared<state>())
     {
+        if(threads == 0)
+            threads = (std::max)(1u, std::thread::hardware_concurrency());
+        workers_.reserve(threads);
+        for(std::size_t i = 0; i < threads; ++i)
+            workers_.emplace_back(&thread_pool_t::run, state_);
     }
 
-    ~signal_t()
+    // 析构时执行完已提交的任务再退出
+    // 最后一个引用在本线程池的任务中释放时，当前工作线程无法 join 自身，改为分离，
+    // 它在当前任务返回后继续执行剩余任务再退出
+    ~thread_pool_t()
     {
-        disconnect_all();
+        {
+            std::lock_guard<std::mutex> lk(state_->mutex);
+            state_->stop = true;
+        }
+        state_->cv.notify_all();
+        for(auto &t : workers_)
+        {
+            if(!t.joinable())
+                continue;
+            if(t.get_id() == std::this_thread::get_id())
+                t.detach();
+            else
+                t.join();
+        }
     }
 
-    signal_t(signal_t &&other) noexcept
-        : impl_(std::move(other.impl_))
-    {
-    }
+    thread_pool_t(const thread_pool_t &)            = delete;
+    thread_pool_t &operator=(const thread_pool_t &) = delete;
 
-    signal_t &operator=(signal_t &&other) noexcept
+    void post(std::function<void()> task) override
     {
-        if(this != &other)
+        if(!task)
+            return;
         {
-            disconnect_all();
-            impl_ = std::move(other.impl_);
+            std::lock_guard<std::mutex> lk(state_->mutex);
+            state_->tasks.push_back(std::move(task));
         }
-        return *this;
+        state_->cv.notify_one();
     }
 
-    signal_t(const signal_t &)            = delete;
-    signal_t &operator=(const signal_t &) = delete;
+    std::size_t size() const { return workers_.size(); }
 
-    // -------------------------------------------------------------------------
-    // connect：任意可调用对象（非成员函数指针）|支持参数适配（槽可以接受比信号更少的参数）
-    // -------------------------------------------------------------------------
-    template <typename Fn>
-    typename std::enable_if<!detail::is_member_function_pointer<typename std::decay<Fn>::type>::value
-                                && detail::callable_arity<Fn, Args...>::is_valid,
-                            connection_t<Args...>>::type
-    connect(Fn &&func, int priority = 0)
+    // 当前线程是否是本线程池的工作线程
+    bool running_in_this_thread() const override
     {
-        return connect_with_arity(std::forward<Fn>(func), priority, false, std::weak_ptr<void>(),
-                                  std::integral_constant<std::size_t, detail::callable_arity<Fn, Args...>::value>());
+        return current() == state_.get();
     }
 
-    // 单次连接
-    template <typename Fn>
-    typename std::enable_if<detail::callable_arity<Fn, Args...>::is_valid,
-                            connection_t<Args...>>::type
-    connect_once(Fn &&func, int priority = 0)
+    // 其他工作线程仍可执行任务，只有单个工作线程的线程池会被当前任务卡住
+    bool stalled_by_this_thread() const override
     {
-        return connect_with_arity(std::forward<Fn>(func), priority, true, std::weak_ptr<void>(),
-                                  std::integral_constant<std::size_t,
-                                                         detail::callable_arity<Fn, Args...>::value>());
+        return workers_.size() == 1 && running_in_this_thread();
     }
 
-    // ---------------------------------------------------------------------
-    // connect：成员函数 + shared_ptr（支持参数适配 + 自动跟踪对象生命周期）
-    // ---------------------------------------------------------------------
-    template <typename Obj, typename MemFn>
-    typename std::enable_if<detail::is_member_function_pointer<typename std::decay<MemFn>::type>::value,
-                            connection_t<Args...>>::type
-    connect(const std::shared_ptr<Obj> &obj, MemFn memfn, int priority = 0)
+private:
+    struct state
     {
-        if(!obj)
-            return connection_t<Args...>();
+        state()
+            : stop(false)
+        {
+        }
 
-        return connect_member_with_arity(
-            obj, memfn, priority, false,
-            std::integral_constant<
-                std::size_t,
-                detail::member_function_arity<MemFn>::value>());
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<std::function<void()>> tasks;
+        bool stop;
+    };
+
+    static const state *&current()
+    {
+        static thread_local const state *pool = nullptr;
+        return pool;
     }
 
-    // ---------------------------------------------------------------------
-    // connect：成员函数 + 裸指针（支持参数适配 + 不跟踪生命周期）
-    // ---------------------------------------------------------------------
-    template <typename Obj, typename MemFn>
-    typename std::enable_if<detail::is_member_function_pointer<typename std::decay<MemFn>::type>::value,
-                            connection_t<Args...>>::type
-    connect(Obj *obj, MemFn memfn, int priority = 0)
+    // 只通过共享状态访问队列，不引用 thread_pool_t 对象本身
+    static void run(std::shared_ptr<state> s)
     {
-        if(!obj)
-            return connection_t<Args...>();
+        current() = s.get();
+        for(;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lk(s->mutex);
+                s->cv.wait(lk, [&s]() { return s->stop || !s->tasks.empty(); });
+                if(s->tasks.empty())
+                    return;
+                task = std::move(s->tasks.front());
+                s->tasks.pop_front();
+            }
 
-        return connect_raw_member_with_arity(
-            obj, memfn, priority, false,
-            std::integral_constant<
-                std::size_t,
-                detail::member_function_arity<MemFn>::value>());
+            try
+            {
+                task();
+            }
+            catch(...)
+            {
+                // 异常吞噬，保证工作线程存活
+            }
+        }
     }
 
-    // -------------------------------------------------------------------------
-    // 带标签的连接（支持参数适配）
-    // -------------------------------------------------------------------------
-    template <typename Fn>
-    typename std::enable_if<detail::callable_arity<Fn, Args...>::is_valid,
-                            connection_t<Args...>>::type
-    connect(const std::string &tag, Fn &&func, int priority = 0)
+    std::shared_ptr<state> state_;
+    std::vector<std::thread> workers_;
+};
+
+// 库默认执行器：进程内共享的线程池，首次使用时创建
+inline std::shared_ptr<executor_t> default_executor()
+{
+    static std::shared_ptr<executor_t> pool = std::make_shared<thread_pool_t>();
+    return pool;
+}
+
+// 当前线程的本地交付队列，首次使用时创建，线程退出时销毁
+// 线程亲和连接从其他线程发射时投递到这里，由本线程在自己的检查点 drain()
+inline const std::shared_ptr<event_loop_t> &this_thread_loop()
+{
+    static thread_local std::shared_ptr<event_loop_t> loop = std::make_shared<event_loop_t>();
+    return loop;
+}
+
+// ============================================================================
+// strand_t：在底层执行器上串行执行任务
+// 同一 strand 上的任务按提交顺序执行且互不并发，不同 strand 之间可以并行
+// ============================================================================
+class strand_t : public executor_t
+{
+public:
+    // ex 不能为空：没有底层执行器时任务永远不会执行
+    explicit strand_t(std::shared_ptr<executor_t> ex)
+        : state_(std::make_shared<state>(std::move(ex)))
     {
-        if(!impl_)
-            return connection_t<Args...>();
+        if(!state_->executor)
+            throw std::invalid_argument("xswl::strand_t: executor must not be null");
+    }
 
-        std::shared_ptr<detail::connection_tag> tag_ptr = get_or_create_tag(tag);
-        return connect_with_arity(
-            std::forward<Fn>(func), priority, false, std::weak_ptr<void>(tag_ptr),
-            std::integral_constant<std::size_t,
-                                   detail::callable_arity<Fn, Args...>::value>(),
-            true);
+    strand_t(const strand_t &)            = delete;
+    strand_t &operator=(const strand_t &) = delete;
+
+    void post(std::function<void()> task) override
+    {
+        if(!task)
+            return;
+        state::enqueue(state_, std::move(task));
     }
 
-    // -------------------------------------------------------------------------
-    // 通过标签断开
-    // -------------------------------------------------------------------------
-    bool disconnect(const std::string &tag)
+    // 当前线程是否正在执行本 strand 的任务
+    bool running_in_this_thread() const override
     {
-        if(!impl_)
-            return false;
+        return state::current() == state_.get();
+    }
 
-        std::lock_guard<std::mutex> lk(impl_->mutex_);
+private:
+    // 状态由 shared_ptr 持有：底层执行器中的批处理任务保活，strand_t 本身可以直接定义为对象
+    struct state
+    {
+        explicit state(std::shared_ptr<executor_t> e)
+            : executor(std::move(e))
+            , running(false)
+        {
+        }
 
-        auto it = std::find_if(
-            impl_->tags_.begin(), impl_->tags_.end(),
-            [&tag](const std::shared_ptr<detail::connection_tag> &t) {
-                return t && t->name == tag;
-            });
+        static const state *&current()
+        {
+            static thread_local const state *active = nullptr;
+            return active;
+        }
 
-        if(it == impl_->tags_.end())
-            return false;
+        static void enqueue(const std::shared_ptr<state> &self, std::function<void()> task)
+        {
+            {
+                std::lock_guard<std::mutex> lk(self->mutex);
+                self->tasks.push_back(std::move(task));
+                if(self->running)
+                    return;
+                self->running = true;
+            }
+            schedule(self);
+        }
+
+        static void schedule(const std::shared_ptr<state> &self)
+        {
+            std::shared_ptr<state> keep = self;
+            self->executor->post([keep]() { run_batch(keep); });
+        }
+
+        // 一次只执行批处理开始时已排队的任务，剩余任务重新投递，避免独占底层线程
+        static void run_batch(const std::shared_ptr<state> &self)
+        {
+            std::size_t budget;
+            {
+                std::lock_guard<std::mutex> lk(self->mutex);
+                budget = self->tasks.size();
+            }
+
+            const state *outer = current();
+            current()          = self.get();
+            for(std::size_t i = 0; i < budget; ++i)
+            {
+                std::unique_lock<std::mutex> lk(self->mutex);
+                if(self->tasks.empty())
+                    break;
+                std::function<void()> task = std::move(self->tasks.front());
+                self->tasks.pop_front();
+                lk.unlock();
+
+                try
+                {
+                    task();
+                }
+                catch(...)
+                {
+                    // 异常吞噬，保证后续任务继续执行
+                }
+            }
+            current() = outer;
+
+            {
+                std::lock_guard<std::mutex> lk(self->mutex);
+                if(self->tasks.empty())
+                {
+                    self->running = false;
+                    return;
+                }
+            }
+            schedule(self);
+        }
+
+        std::shared_ptr<executor_t> executor;
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+        bool running; // 是否已有批处理任务在底层执行器中
+    };
+
+    std::shared_ptr<state> state_;
+};
+
+// ============================================================================
+// 连接选项
+// ============================================================================
+enum class rate_limit_t
+{
+    none,
+    throttle, // 间隔内至多调用一次（前沿触发）
+    debounce  // 安静期结束后以最新参数调用一次（后沿触发）
+};
+
+// 有界排队连接在邮箱已满时的处理方式
+enum class overflow_t
+{
+    block,       // 阻塞发射线程，直到交付腾出空间
+    drop_newest, // 丢弃本次发射
+    drop_oldest, // 丢弃最早的积压，再入队本次发射
+    coalesce     // 用本次参数覆盖最新的积压
+};
+
+// 排队连接的邮箱统计
+struct queue_stats_t
+{
+    std::size_t pending;   // 当前积压数量
+    std::size_t capacity;  // 容量上限，0 表示无界
+    std::uint64_t dropped; // 因溢出被丢弃或覆盖的发射数量
+    std::uint64_t blocked; // 因溢出而阻塞过发射线程的次数
+};
+
+// 设置了耗时预算的连接的运行时开销
+struct slot_cost_t
+{
+    std::chrono::nanoseconds average; // 单次调用耗时的指数移动平均
+    std::chrono::nanoseconds budget;  // 0 表示未设置预算
+    bool slow;                        // 平均耗时超出预算
+    bool offloaded;                   // 已迁移到 offload 执行器
+};
+
+// 开启统计后单个槽的调用计数与耗时
+struct slot_stats_t
+{
+    std::uint64_t calls;            // 调用次数（含抛出异常的调用）
+    std::uint64_t exceptions;       // 抛出异常的次数
+    std::chrono::nanoseconds total; // 累计耗时
+    std::chrono::nanoseconds max;   // 单次最大耗时
+
+    std::chrono::nanoseconds average() const
+    {
+        return calls ? total / static_cast<std::chrono::nanoseconds::rep>(calls)
+                     : std::chrono::nanoseconds(0);
+    }
+};
+
+// 信号内部互斥量的竞争统计（以 XSWL_SIGNALS_LOCK_STATS 编译时收集）
+struct lock_stats_t
+{
+    std::uint64_t acquisitions;         // 加锁次数
+    std::uint64_t contended;            // 加锁时需要等待的次数
+    std::chrono::nanoseconds wait;      // 累计等待时间
+    std::chrono::nanoseconds max_wait;  // 单次最长等待
+};
+
+// 采样剖析得到的单个信号汇总；各项只基于被采样的发射
+struct emit_profile_t
+{
+    std::string name;                       // 信号名称，未命名时为空
+    const void *signal;                     // 信号内部状态地址，与追踪、USDT 中的信号地址一致
+    std::uint64_t samples;                  // 被采样的发射次数
+    std::uint64_t estimated_emissions;      // 估算的发射总数：每个样本按其采样时的周期计入
+    double mean_fanout;                     // 每次发射调用的槽数（平均）
+    std::size_t max_fanout;                 // 单次发射调用的最多槽数
+    std::chrono::nanoseconds mean_duration; // 发射耗时（平均）
+    std::chrono::nanoseconds max_duration;  // 发射耗时（最大）
+    const void *slowest_slot;               // 采样中单次耗时最长的槽地址
+    std::chrono::nanoseconds slowest_slot_duration;
+};
+
+// 信号占用内存的估算（字节）；共享控制块按 make_shared 的典型布局计入
+struct memory_usage_t
+{
+    std::size_t signal;      // 信号共享状态本身
+    std::size_t slots;       // 槽记录
+    std::size_t captures;    // std::function 在堆上保存的可调用对象
+    std::size_t dispatchers; // 排队、限流、预算等投递策略及其积压参数
+    std::size_t tags;        // 标签记录与标签名
+    std::size_t containers;  // 槽表、发射快照、标签表等容器的容量
+    std::size_t slot_count;  // 统计到的槽记录数（含等待清理的）
+
+    std::size_t total() const
+    {
+        return signal + slots + captures + dispatchers + tags + containers;
+    }
+};
+
+// 全局信号登记表快照中的一项
+struct signal_info_t
+{
+    std::string name;                            // 登记时使用的名称
+    const void *signal;                          // 信号内部状态地址，与追踪、USDT 中一致
+    std::size_t slot_count;                      // 当前连接数（不含等待清理的）
+    std::uint64_t emissions;                     // 登记以来的发射次数
+    double emission_rate;                        // 每秒发射次数（自上次快照或登记以来）
+    double mean_fanout;                          // 每次发射调用的槽数；来自采样剖析，未采样时为 0
+    std::chrono::nanoseconds mean_emit_duration; // 发射耗时；来自采样剖析，未采样时为 0
+    memory_usage_t memory;
+};
+
+class connect_options_t
+{
+public:
+    // 允许从 int 隐式构造，保持 connect(fn, priority) 的写法
+    connect_options_t(int priority = 0)
+        : priority_(priority)
+        , coalesce_(false)
+        , rate_limit_(rate_limit_t::none)
+        , rate_interval_(0)
+        , capacity_(0)
+        , overflow_(overflow_t::drop_oldest)
+        , thread_affine_(false)
+        , budget_(0)
+    {
+    }
+
+    int priority() const { return priority_; }
+
+    connect_options_t &priority(int p)
+    {
+        priority_ = p;
+        return *this;
+    }
+
+    // 排队连接：发射时只入队，槽在 executor 上运行
+    connect_options_t &queued(std::shared_ptr<executor_t> ex)
+    {
+        executor_      = std::move(ex);
+        coalesce_      = false;
+        thread_affine_ = false;
+        return *this;
+    }
+
+    // 合并连接：未交付的发射合并为最新的一组参数，每次交付至多调用一次槽
+    connect_options_t &coalesced(std::shared_ptr<executor_t> ex)
+    {
+        executor_      = std::move(ex);
+        coalesce_      = true;
+        thread_affine_ = false;
+        return *this;
+    }
+
+    // 线程亲和：记录执行 connect 的线程；该线程发射时直接调用槽，
+    // 其他线程发射时投递到它的 this_thread_loop()，由它自行 drain()
+    connect_options_t &thread_affine()
+    {
+        executor_.reset();
+        coalesce_      = false;
+        thread_affine_ = true;
+        return *this;
+    }
+
+    // 节流：interval 内只有第一次发射会调用槽，其余发射只付出一次时间戳比较
+    // interval 不足 1ns 时抛出 std::invalid_argument
+    template <typename Rep, typename Period>
+    connect_options_t &throttle(const std::chrono::duration<Rep, Period> &interval)
+    {
+        rate_interval_ = positive_interval(interval, "throttle interval");
+        rate_limit_    = rate_limit_t::throttle;
+        return *this;
+    }
+
+    // 防抖：最后一次发射后安静 delay 时间，再以最新参数调用槽（由库内定时轮触发）
+    // delay 不足 1ns 时抛出 std::invalid_argument
+    template <typename Rep, typename Period>
+    connect_options_t &debounce(const std::chrono::duration<Rep, Period> &delay)
+    {
+        rate_interval_ = positive_interval(delay, "debounce delay");
+        rate_limit_    = rate_limit_t::debounce;
+        return *this;
+    }
+
+    // 排队连接的邮箱容量，0 表示无界；合并连接本身至多积压一项，不受影响
+    connect_options_t &capacity(std::size_t n)
+    {
+        capacity_ = n;
+        return *this;
+    }
+
+    // 邮箱已满时的处理方式，默认 drop_oldest
+    connect_options_t &overflow(overflow_t policy)
+    {
+        overflow_ = policy;
+        return *this;
+    }
+
+    // 耗时预算：统计同步调用的平均耗时，超出预算时标记为慢槽
+    template <typename Rep, typename Period>
+    connect_options_t &budget(const std::chrono::duration<Rep, Period> &limit)
+    {
+        budget_ = std::chrono::duration_cast<std::chrono::nanoseconds>(limit);
+        return *this;
+    }
+
+    // 慢槽迁移的目标执行器：超出预算后，后续发射改为排队到 ex 上执行
+    connect_options_t &offload(std::shared_ptr<executor_t> ex)
+    {
+        offload_ = std::move(ex);
+        return *this;
+    }
+
+    std::size_t capacity() const { return capacity_; }
+    overflow_t overflow() const { return overflow_; }
+    bool is_thread_affine() const { return thread_affine_; }
+    std::chrono::nanoseconds budget() const { return budget_; }
+    const std::shared_ptr<executor_t> &offload() const { return offload_; }
+
+    const std::shared_ptr<executor_t> &executor() const { return executor_; }
+    bool is_queued() const { return executor_ != nullptr; }
+    bool is_coalesced() const { return executor_ != nullptr && coalesce_; }
+    rate_limit_t rate_limit() const { return rate_limit_; }
+    std::chrono::nanoseconds rate_interval() const { return rate_interval_; }
+
+private:
+    // 限流间隔必须为正：0 或负值会让节流退化为直接调用、防抖立即到期
+    template <typename Rep, typename Period>
+    static std::chrono::nanoseconds positive_interval(const std::chrono::duration<Rep, Period> &d,
+                                                      const char *what)
+    {
+        std::chrono::nanoseconds ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d);
+        if(ns.count() <= 0)
+            throw std::invalid_argument(std::string("xswl::connect_options_t: ") + what +
+                                        " must be positive");
+        return ns;
+    }
+
+    int priority_;
+    std::shared_ptr<executor_t> executor_;
+    bool coalesce_;
+    rate_limit_t rate_limit_;
+    std::chrono::nanoseconds rate_interval_;
+    std::size_t capacity_;
+    overflow_t overflow_;
+    bool thread_affine_;
+    std::chrono::nanoseconds budget_;
+    std::shared_ptr<executor_t> offload_;
+};
+
+namespace detail {
+
+// ============================================================================
+// C++11 index_sequence 实现
+// ============================================================================
+template <std::size_t... Is>
+struct index_sequence
+{
+};
+
+template <std::size_t N, std::size_t... Is>
+struct make_index_sequence_impl : make_index_sequence_impl<N - 1, N - 1, Is...>
+{
+};
+
+template <std::size_t... Is>
+struct make_index_sequence_impl<0, Is...>
+{
+    typedef index_sequence<Is...> type;
+};
+
+template <std::size_t N>
+struct make_index_sequence
+{
+    typedef typename make_index_sequence_impl<N>::type type;
+};
+
+// ============================================================================
+// 可调用性检测
+// ============================================================================
+
+// 检测 F 是否可以用 Args... 调用
+template <typename F, typename... Args>
+struct is_invocable
+{
+private:
+    template <typename Fn>
+    static auto test(int)
+        -> decltype(std::declval<Fn>()(std::declval<Args>()...), std::true_type{});
+
+    template <typename>
+    static std::false_type test(...);
+
+public:
+    static const bool value = decltype(test<F>(0))::value;
+};
+
+// 检测 F 是否可以用 tuple 中前 N 个元素调用
+template <typename F, typename Tuple, typename Indices>
+struct is_invocable_with_n_impl;
+
+template <typename F, typename Tuple, std::size_t... Is>
+struct is_invocable_with_n_impl<F, Tuple, index_sequence<Is...>>
+{
+private:
+    template <typename Fn>
+    static auto test(int)
+        -> decltype(std::declval<Fn>()(
+                        std::declval<typename std::tuple_element<Is, Tuple>::type>()...),
+                    std::true_type{});
+
+    template <typename>
+    static std::false_type test(...);
+
+public:
+    static const bool value = decltype(test<F>(0))::value;
+};
+
+template <typename F, std::size_t N, typename... Args>
+struct is_invocable_with_n
+{
+    typedef std::tuple<Args...> tuple_type;
+    typedef typename make_index_sequence<N>::type indices;
+    static const bool value = is_invocable_with_n_impl<F, tuple_type, indices>::value;
+};
+
+// ============================================================================
+// 参数数量检测（找到最大可调用参数数量）
+// ============================================================================
+template <typename F, std::size_t N, std::size_t Max, typename... Args>
+struct find_callable_arity_impl
+{
+    static const std::size_t value =
+        is_invocable_with_n<F, N, Args...>::value
+            ? N
+            : find_callable_arity_impl<F, N - 1, Max, Args...>::value;
+};
+
+template <typename F, std::size_t Max, typename... Args>
+struct find_callable_arity_impl<F, 0, Max, Args...>
+{
+    static const std::size_t value = is_invocable<F>::value ? 0 : Max + 1; // Max+1 表示无法调用
+};
+
+template <typename F, typename... Args>
+struct callable_arity
+{
+    static const std::size_t max_args = sizeof...(Args);
+    static const std::size_t value =
+        find_callable_arity_impl<F, max_args, max_args, Args...>::value;
+    static const bool is_valid = (value <= max_args);
+};
+
+// ============================================================================
+// 参数适配器：将信号参数适配为槽函数需要的参数数量（通用实现）
+// ============================================================================
+// R 为信号的返回类型，void 信号会丢弃槽的返回值
+template <typename R, typename Fn, std::size_t N,
+          typename Indices = typename make_index_sequence<N>::type>
+struct arg_adapter;
+
+template <typename R, typename Fn, std::size_t N, std::size_t... Is>
+struct arg_adapter<R, Fn, N, index_sequence<Is...>>
+{
+    Fn fn;
+    explicit arg_adapter(Fn f)
+        : fn(std::move(f)) {}
+
+    // 非 const 版本
+    template <typename... Args>
+    R operator()(Args &&... args)
+    {
+        return static_cast<R>(
+            fn(std::get<Is>(std::forward_as_tuple(std::forward<Args>(args)...))...));
+    }
+
+    // const 版本
+    template <typename... Args>
+    R operator()(Args &&... args) const
+    {
+        return static_cast<R>(
+            fn(std::get<Is>(std::forward_as_tuple(std::forward<Args>(args)...))...));
+    }
+};
+
+// 适配器工厂函数
+template <typename R, std::size_t N, typename Fn>
+arg_adapter<R, typename std::decay<Fn>::type, N> make_arg_adapter(Fn &&fn)
+{
+    return arg_adapter<R, typename std::decay<Fn>::type, N>(std::forward<Fn>(fn));
+}
+
+// ============================================================================
+// 成员函数参数数量萃取
+// ============================================================================
+template <typename T>
+struct member_function_arity;
+
+template <typename C, typename R>
+struct member_function_arity<R (C::*)()>
+{
+    static const std::size_t value = 0;
+};
+
+template <typename C, typename R>
+struct member_function_arity<R (C::*)() const>
+{
+    static const std::size_t value = 0;
+};
+
+template <typename C, typename R, typename A1>
+struct member_function_arity<R (C::*)(A1)>
+{
+    static const std::size_t value = 1;
+};
+
+template <typename C, typename R, typename A1>
+struct member_function_arity<R (C::*)(A1) const>
+{
+    static const std::size_t value = 1;
+};
+
+template <typename C, typename R, typename A1, typename A2>
+struct member_function_arity<R (C::*)(A1, A2)>
+{
+    static const std::size_t value = 2;
+};
+
+template <typename C, typename R, typename A1, typename A2>
+struct member_function_arity<R (C::*)(A1, A2) const>
+{
+    static const std::size_t value = 2;
+};
+
+template <typename C, typename R, typename A1, typename A2, typename A3>
+struct member_function_arity<R (C::*)(A1, A2, A3)>
+{
+    static const std::size_t value = 3;
+};
+
+template <typename C, typename R, typename A1, typename A2, typename A3>
+struct member_function_arity<R (C::*)(A1, A2, A3) const>
+{
+    static const std::size_t value = 3;
+};
+
+template <typename C, typename R, typename A1, typename A2, typename A3, typename A4>
+struct member_function_arity<R (C::*)(A1, A2, A3, A4)>
+{
+    static const std::size_t value = 4;
+};
+
+template <typename C, typename R, typename A1, typename A2, typename A3, typename A4>
+struct member_function_arity<R (C::*)(A1, A2, A3, A4) const>
+{
+    static const std::size_t value = 4;
+};
+
+template <typename C, typename R, typename A1, typename A2, typename A3, typename A4,
+          typename A5>
+struct member_function_arity<R (C::*)(A1, A2, A3, A4, A5)>
+{
+    static const std::size_t value = 5;
+};
+
+template <typename C, typename R, typename A1, typename A2, typename A3, typename A4,
+          typename A5>
+struct member_function_arity<R (C::*)(A1, A2, A3, A4, A5) const>
+{
+    static const std::size_t value = 5;
+};
+
+template <typename C, typename R, typename A1, typename A2, typename A3, typename A4,
+          typename A5, typename A6>
+struct member_function_arity<R (C::*)(A1, A2, A3, A4, A5, A6)>
+{
+    static const std::size_t value = 6;
+};
+
+template <typename C, typename R, typename A1, typename A2, typename A3, typename A4,
+          typename A5, typename A6>
+struct member_function_arity<R (C::*)(A1, A2, A3, A4, A5, A6) const>
+{
+    static const std::size_t value = 6;
+};
+
+// ============================================================================
+// 内存估算辅助
+// ============================================================================
+// make_shared 控制块在对象之外的开销：虚表指针与两个引用计数
+constexpr std::size_t shared_block_overhead = sizeof(void *) + 2 * sizeof(int);
+
+// 字符串超出短字符串缓冲区后的堆占用
+inline std::size_t string_heap_bytes(const std::string &s)
+{
+    static const std::size_t inline_capacity = std::string().capacity();
+    return s.capacity() > inline_capacity ? s.capacity() + 1 : 0;
+}
+
+// std::function 能否把 F 存放在内部缓冲区：按所用标准库的小对象规则估算，不考虑超对齐类型
+#if defined(_LIBCPP_VERSION)
+// libc++：三个指针大小的缓冲区，要求复制构造不抛异常
+template <typename F>
+struct function_stores_inline
+    : std::integral_constant<bool, sizeof(F) <= 3 * sizeof(void *) &&
+                                       std::is_nothrow_copy_constructible<F>::value>
+{
+};
+#elif defined(_MSC_VER)
+// MSVC STL：缓冲区除虚表指针外可放 4 个指针加 16 字节，要求移动构造不抛异常
+template <typename F>
+struct function_stores_inline
+    : std::integral_constant<bool, sizeof(F) <= 4 * sizeof(void *) + 16 &&
+                                       std::is_nothrow_move_constructible<F>::value>
+{
+};
+#else
+// libstdc++（其他标准库同样按此估算）：两个指针大小的缓冲区，要求平凡可复制
+template <typename F>
+struct function_stores_inline
+    : std::integral_constant<bool, sizeof(F) <= 2 * sizeof(void *) &&
+                                       std::is_trivially_copyable<F>::value>
+{
+};
+#endif
+
+// std::function 保存 F 时的堆占用估算：函数指针与可放入内部缓冲区的对象计为 0；
+// 已经是 Function 的对象无法得知其目标，按 0 计
+template <typename F, typename Function>
+struct function_capture_bytes
+    : std::integral_constant<std::size_t,
+                             (std::is_same<F, Function>::value || std::is_pointer<F>::value ||
+                              function_stores_inline<F>::value)
+                                 ? 0
+                                 : sizeof(F)>
+{
+};
+
+// ============================================================================
+// 槽函数封装
+// ============================================================================
+template <typename... Args>
+struct slot;
+
+// 投递策略：非空时由它决定槽在何时、何处被调用（排队、合并等）
+template <typename... Args>
+struct slot_dispatcher
+{
+    virtual ~slot_dispatcher() {}
+    virtual void dispatch(const std::shared_ptr<slot<Args...>> &s, Args &... args) = 0;
+
+    // 排队类策略填写邮箱统计并返回 true；限流等包装策略转发给内层
+    virtual bool query_queue(queue_stats_t &) const { return false; }
+
+    // 设置了耗时预算的策略填写开销统计并返回 true
+    virtual bool query_cost(slot_cost_t &) const { return false; }
+
+    // 策略对象（含内层策略与积压参数）占用的内存估算
+    virtual std::size_t memory_usage() const = 0;
+};
+
+// 槽的函数类型：signal_t<Args...> 为 void(Args...)，signal_t<R(Args...)> 为 R(Args...)
+template <typename... Args>
+struct slot_signature
+{
+    using result_type   = void;
+    using function_type = std::function<void(Args...)>;
+    using args_tuple    = std::tuple<typename std::decay<Args>::type...>;
+};
+
+template <typename R, typename... Args>
+struct slot_signature<R(Args...)>
+{
+    using result_type   = R;
+    using function_type = std::function<R(Args...)>;
+    using args_tuple    = std::tuple<typename std::decay<Args>::type...>;
+};
+
+inline long long steady_now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// 槽调用统计计数器：均为 relaxed 原子量，多个线程同时调用同一槽时不加锁
+struct slot_stats_counters
+{
+    std::atomic<bool> enabled{true};
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> exceptions{0};
+    std::atomic<long long> total_ns{0};
+    std::atomic<long long> max_ns{0};
+
+    void record(long long ns, bool threw)
+    {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        if(threw)
+            exceptions.fetch_add(1, std::memory_order_relaxed);
+        total_ns.fetch_add(ns, std::memory_order_relaxed);
+        long long prev = max_ns.load(std::memory_order_relaxed);
+        while(ns > prev && !max_ns.compare_exchange_weak(prev, ns, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    slot_stats_t snapshot() const
+    {
+        slot_stats_t out = {calls.load(std::memory_order_relaxed),
+                            exceptions.load(std::memory_order_relaxed),
+                            std::chrono::nanoseconds(total_ns.load(std::memory_order_relaxed)),
+                            std::chrono::nanoseconds(max_ns.load(std::memory_order_relaxed))};
+        return out;
+    }
+};
+
+// 槽调用计时：统计开启时记录一次调用；done() 之前离开作用域计为抛出异常
+class slot_call_timer
+{
+public:
+    explicit slot_call_timer(const std::atomic<slot_stats_counters *> &stats)
+        : stats_(stats.load(std::memory_order_acquire))
+        , start_(stats_ && stats_->enabled.load(std::memory_order_relaxed) ? steady_now_ns() : -1)
+        , done_(false)
+    {
+    }
+
+    ~slot_call_timer()
+    {
+        if(start_ >= 0)
+            stats_->record(steady_now_ns() - start_, !done_);
+    }
+
+    void done() { done_ = true; }
+
+    slot_call_timer(const slot_call_timer &)            = delete;
+    slot_call_timer &operator=(const slot_call_timer &) = delete;
+
+private:
+    slot_stats_counters *stats_;
+    long long start_;
+    bool done_;
+};
+
+// 当前线程正在进行的发射是否被槽要求停止传播
+inline bool &emission_stop_flag()
+{
+    static thread_local bool stopped = false;
+    return stopped;
+}
+
+// 进入一次发射或排队交付时清除停止标志，退出时恢复外层发射的状态（支持嵌套发射）
+class emission_scope
+{
+public:
+    emission_scope()
+        : outer_(emission_stop_flag())
+    {
+        emission_stop_flag() = false;
+    }
+
+    ~emission_scope()
+    {
+        emission_stop_flag() = outer_;
+    }
+
+    emission_scope(const emission_scope &)            = delete;
+    emission_scope &operator=(const emission_scope &) = delete;
+
+private:
+    bool outer_;
+};
+
+template <typename... Args>
+struct slot
+{
+    using result_type     = typename slot_signature<Args...>::result_type;
+    using function_type   = typename slot_signature<Args...>::function_type;
+    using dispatcher_type = slot_dispatcher<Args...>;
+
+    function_type func;
+    int priority;
+    std::atomic<bool> blocked;         // 是否被 block
+    std::atomic<bool> pending_removal; // 是否等待删除
+    std::atomic<bool> executed;        // 用于单次槽的 CAS 控制
+    std::atomic<bool> disconnected;    // 被显式断开（区别于单次槽触发后的自动删除）
+    bool single_shot;                  // 是否一次性
+    std::weak_ptr<void> tracked;       // 跟踪的 owner/tag（生命周期控制）
+    bool tracked_set;                  // 是否曾经设置过 tracked
+    std::uint32_t capture_bytes;       // func 在堆上保存的可调用对象大小（估算，占用原有填充）
+    std::shared_ptr<dispatcher_type> dispatcher; // 为空表示直接调用
+    std::atomic<slot_stats_counters *> stats;    // 信号开启统计后创建，随槽释放
+
+    slot(function_type f, int p, bool ss, std::weak_ptr<void> t, bool has_tracked)
+        : func(std::move(f))
+        , priority(p)
+        , blocked(false)
+        , pending_removal(false)
+        , executed(false)
+        , disconnected(false)
+        , single_shot(ss)
+        , tracked(std::move(t))
+        , tracked_set(has_tracked)
+        , capture_bytes(0)
+        , stats(nullptr)
+    {
+    }
+
+    ~slot() { delete stats.load(std::memory_order_relaxed); }
+
+    // 调用槽函数并按需计入统计
+    template <typename... Ts>
+    void call(Ts &&... args)
+    {
+        slot_call_timer timer(stats);
+        func(std::forward<Ts>(args)...);
+        timer.done();
+    }
+
+    // 槽记录、堆上的可调用对象、统计计数器与投递策略
+    std::size_t memory_usage() const
+    {
+        return sizeof(*this) + shared_block_overhead + capture_bytes +
+               (stats.load(std::memory_order_relaxed) ? sizeof(slot_stats_counters) : 0) +
+               (dispatcher ? dispatcher->memory_usage() : 0);
+    }
+
+    // 基础检查（不包含单次槽的执行状态）
+    // 优化：使用 relaxed 读取非关键标志，减少内存屏障开销
+    bool is_callable() const
+    {
+        // 先检查快速路径：blocked 和 pending_removal 用 relaxed 读取
+        // 这些标志的精确同步不影响正确性，最多延迟一次调用
+        if(blocked.load(std::memory_order_relaxed) ||
+           pending_removal.load(std::memory_order_relaxed))
+            return false;
+
+        if(tracked_set && tracked.expired())
+            return false;
+
+        return true;
+    }
+
+    // 显式断开：之后的发射与尚未完成的排队交付都不再调用
+    void mark_disconnected()
+    {
+        disconnected.store(true, std::memory_order_release);
+        pending_removal.store(true, std::memory_order_release);
+    }
+
+    // 排队交付时的检查：单次槽在发射时已被标记删除，但仍需完成这一次交付，
+    // 除非之后被显式断开
+    bool is_deliverable() const
+    {
+        if(tracked_set && tracked.expired())
+            return false;
+        if(disconnected.load(std::memory_order_acquire))
+            return false;
+
+        return single_shot || !pending_removal.load(std::memory_order_acquire);
+    }
+
+    // 尝试获取执行权（用于单次槽的线程安全）
+    bool try_acquire_execution()
+    {
+        if(!single_shot)
+            return true;
+
+        bool expected = false;
+        return executed.compare_exchange_strong(expected, true,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire);
+    }
+};
+
+// ============================================================================
+// 以 tuple 展开调用
+// ============================================================================
+template <typename Fn, typename Tuple, std::size_t... Is>
+auto apply_tuple_impl(Fn &fn, Tuple &t, index_sequence<Is...>)
+    -> decltype(fn(std::get<Is>(t)...))
+{
+    return fn(std::get<Is>(t)...);
+}
+
+template <typename Fn, typename... Ts>
+auto apply_tuple(Fn &fn, std::tuple<Ts...> &t)
+    -> decltype(apply_tuple_impl(fn, t, typename make_index_sequence<sizeof...(Ts)>::type()))
+{
+    return apply_tuple_impl(fn, t, typename make_index_sequence<sizeof...(Ts)>::type());
+}
+
+// ============================================================================
+// tuple 哈希与去重：延迟发射的全量去重在补发时线性完成
+// ============================================================================
+// 检测 T 是否可以用 std::hash 求哈希
+template <typename T>
+struct is_hashable
+{
+private:
+    template <typename U>
+    static auto test(int)
+        -> decltype(std::hash<U>()(std::declval<const U &>()), std::true_type{});
+
+    template <typename>
+    static std::false_type test(...);
+
+public:
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+template <bool... Bs>
+struct bool_pack
+{
+};
+
+template <typename Tuple>
+struct is_tuple_hashable;
+
+template <typename... Ts>
+struct is_tuple_hashable<std::tuple<Ts...>>
+    : std::is_same<bool_pack<true, is_hashable<Ts>::value...>,
+                   bool_pack<is_hashable<Ts>::value..., true>>
+{
+};
+
+template <typename Tuple, std::size_t... Is>
+std::size_t hash_tuple_impl(const Tuple &t, index_sequence<Is...>)
+{
+    std::size_t seed = 0;
+    int expand[]     = {0, (seed ^= std::hash<typename std::tuple_element<Is, Tuple>::type>()(
+                                        std::get<Is>(t)) +
+                                    0x9e3779b9 + (seed << 6) + (seed >> 2),
+                            0)...};
+    (void)expand;
+    return seed;
+}
+
+template <typename Tuple>
+struct tuple_ptr_hash
+{
+    std::size_t operator()(const Tuple *t) const
+    {
+        return hash_tuple_impl(
+            *t, typename make_index_sequence<std::tuple_size<Tuple>::value>::type());
+    }
+};
+
+template <typename Tuple>
+struct tuple_ptr_equal
+{
+    bool operator()(const Tuple *a, const Tuple *b) const { return *a == *b; }
+};
+
+// 保留每组相同参数首次出现的位置，其余按原顺序前移
+template <typename Tuple>
+void unique_tuples(std::vector<Tuple> &items)
+{
+    std::unordered_set<const Tuple *, tuple_ptr_hash<Tuple>, tuple_ptr_equal<Tuple>> seen;
+    seen.reserve(items.size());
+    std::vector<char> keep(items.size());
+    for(std::size_t i = 0; i < items.size(); ++i)
+        keep[i] = seen.insert(&items[i]).second;
+    seen.clear(); // 前移会改动元素，先丢弃指向它们的指针
+
+    std::size_t out = 0;
+    for(std::size_t i = 0; i < items.size(); ++i)
+    {
+        if(!keep[i])
+            continue;
+        if(out != i)
+            items[out] = std::move(items[i]);
+        ++out;
+    }
+    items.erase(items.begin() + out, items.end());
+}
+
+template <typename Tuple>
+void (*unique_tuples_for(std::true_type))(std::vector<Tuple> &)
+{
+    return &unique_tuples<Tuple>;
+}
+
+// 参数不可哈希：不做全量去重，只保留发射时的连续去重
+template <typename Tuple>
+void (*unique_tuples_for(std::false_type))(std::vector<Tuple> &)
+{
+    return nullptr;
+}
+
+// ============================================================================
+// 排队投递：每个连接一个邮箱，同一时刻至多一个交付任务在执行器中
+// ============================================================================
+// 一个交付任务最多交付的参数个数；余下的积压作为续作以连接优先级重新投递，
+// 让执行器有机会在批次之间运行其他车道的任务，event_loop_t 仍在同一次 drain 中交付完
+static const std::size_t queued_delivery_batch = 64;
+
+template <typename... Args>
+class queued_dispatcher
+    : public slot_dispatcher<Args...>
+    , public std::enable_shared_from_this<queued_dispatcher<Args...>>
+{
+public:
+    using slot_ptr   = std::shared_ptr<slot<Args...>>;
+    using args_tuple = std::tuple<typename std::decay<Args>::type...>;
+
+    queued_dispatcher(const std::shared_ptr<executor_t> &ex, bool coalesce,
+                      std::size_t capacity = 0, overflow_t overflow = overflow_t::drop_oldest)
+        : executor_(ex)
+        , coalesce_(coalesce)
+        , capacity_(coalesce ? 0 : capacity)
+        , overflow_(overflow)
+        , scheduled_(false)
+        , waiters_(0)
+        , dropped_(0)
+        , blocked_(0)
+    {
+    }
+
+    void dispatch(const slot_ptr &s, Args &... args) override
+    {
+        // 在加锁前查询执行器：临时的 shared_ptr 可能是最后一个引用，
+        // 持锁析构线程池会 join 正在 deliver() 中等待本锁的工作线程
+        const bool on_executor = overflow_ == overflow_t::block && capacity_ != 0 &&
+                                 stalls_executor();
+        {
+            std::unique_lock<std::mutex> lk(mutex_);
+            if(coalesce_ && !queue_.empty())
+            {
+                queue_.back() = args_tuple(args...);
+            }
+            else
+            {
+                if(capacity_ != 0 && queue_.size() >= capacity_ &&
+                   !make_room(lk, on_executor, args...))
+                    return;
+                queue_.emplace_back(args...);
+            }
+
+            if(scheduled_)
+                return;
+            scheduled_ = true;
+        }
+        schedule(s);
+    }
+
+    bool query_queue(queue_stats_t &out) const override
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        out.pending  = queue_.size();
+        out.capacity = capacity_;
+        out.dropped  = dropped_;
+        out.blocked  = blocked_;
+        return true;
+    }
+
+    std::size_t memory_usage() const override
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return sizeof(*this) + shared_block_overhead + queue_.size() * sizeof(args_tuple);
+    }
+
+private:
+    // 当前线程正在交付的邮箱；槽内重入发射时不能阻塞等待自己腾出空间
+    static const queued_dispatcher *&delivering()
+    {
+        static thread_local const queued_dispatcher *current = nullptr;
+        return current;
+    }
+
+    // 发射线程卡住执行器时，交付任务在本线程返回前无法运行；多线程池的其他工作线程仍可消费
+    bool stalls_executor() const
+    {
+        auto ex = executor_.lock();
+        return ex && ex->stalled_by_this_thread();
+    }
+
+    // 邮箱已满：按策略处理，返回 true 表示本次发射仍需入队
+    // 满时必有交付任务在执行器中，调用方无需重新调度
+    bool make_room(std::unique_lock<std::mutex> &lk, bool on_executor, Args &... args)
+    {
+        switch(overflow_)
+        {
+        case overflow_t::drop_newest:
+            ++dropped_;
+            return false;
+        case overflow_t::drop_oldest:
+            queue_.pop_front();
+            ++dropped_;
+            return true;
+        case overflow_t::coalesce:
+            queue_.back() = args_tuple(args...);
+            ++dropped_;
+            return false;
+        case overflow_t::block:
+            break;
+        }
+
+        // 槽内重入，或发射线程卡住了消费本邮箱的执行器：等待永远不会结束，放弃本次发射
+        if(delivering() == this || on_executor)
+        {
+            ++dropped_;
+            return false;
+        }
+
+        ++blocked_;
+        ++waiters_;
+        while(queue_.size() >= capacity_)
+        {
+            // 分段等待：执行器销毁后积压不会再被消费，此时放弃本次发射
+            if(executor_.expired())
+            {
+                --waiters_;
+                ++dropped_;
+                return false;
+            }
+            space_.wait_for(lk, std::chrono::milliseconds(10));
+        }
+        --waiters_;
+        return true;
+    }
+
+    struct delivery_task
+    {
+        std::shared_ptr<queued_dispatcher> self;
+        slot_ptr s;
+        std::size_t owed; // 续作还需交付的积压数；0 表示新的交付任务
+        void operator()() { self->deliver(s, owed); }
+    };
+
+    void schedule(const slot_ptr &s, std::size_t owed = 0)
+    {
+        auto ex = executor_.lock();
+        if(!ex)
+        {
+            // 执行器已销毁：丢弃积压，后续发射同样会被丢弃
+            std::lock_guard<std::mutex> lk(mutex_);
+            queue_.clear();
+            scheduled_ = false;
+            space_.notify_all();
+            return;
+        }
+        delivery_task task = {this->shared_from_this(), s, owed};
+        if(owed != 0)
+            ex->post_continuation(task, s->priority);
+        else
+            ex->post_prioritized(task, s->priority);
+    }
+
+    // 只交付任务开始时已积压的参数，且每个任务至多 queued_delivery_batch 个，
+    // 其余作为续作提交；之后新到的参数由新的交付任务处理，高频生产者不会让一次交付无限延长
+    void deliver(const slot_ptr &s, std::size_t owed)
+    {
+        std::size_t budget;
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            if(owed == 0)
+                owed = queue_.size();
+            budget = (std::min)(owed, queued_delivery_batch);
+        }
+        owed -= budget;
+
+        const queued_dispatcher *outer = delivering();
+        delivering()                   = this;
+        for(std::size_t i = 0; i < budget; ++i)
+        {
+            std::unique_lock<std::mutex> lk(mutex_);
+            if(queue_.empty())
+                break;
+            args_tuple item(std::move(queue_.front()));
+            queue_.pop_front();
+            if(waiters_ != 0)
+                space_.notify_one();
+            lk.unlock();
+
+            if(!s->is_deliverable())
+                continue;
+
+            try
+            {
+                emission_scope scope; // 槽内的 stop_propagation() 只作用于本次交付
+                slot_call_timer timer(s->stats);
+                apply_tuple(s->func, item);
+                timer.done();
+            }
+            catch(...)
+            {
+                // 异常吞噬，防止影响其他交付
+            }
+        }
+        delivering() = outer;
+
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            if(queue_.empty())
+            {
+                scheduled_ = false;
+                return;
+            }
+        }
+        schedule(s, owed);
+    }
+
+    std::weak_ptr<executor_t> executor_;
+    bool coalesce_;
+    std::size_t capacity_; // 0 表示无界
+    overflow_t overflow_;
+    mutable std::mutex mutex_;
+    std::condition_variable space_; // block 策略下等待邮箱腾出空间
+    std::deque<args_tuple> queue_;  // 合并模式下长度不超过 1
+    bool scheduled_;                // 是否已有交付任务在执行器中
+    std::size_t waiters_;           // 正在等待空间的发射线程数
+    std::uint64_t dropped_;
+    std::uint64_t blocked_;
+};
+
+// ============================================================================
+// 分层定时轮：库内共享的后台线程，驱动防抖等延迟交付
+// 4 层 x 64 槽，最小刻度 1ms；高层槽在低层回绕时逐级下沉
+// ============================================================================
+class timer_wheel
+{
+public:
+    typedef std::chrono::steady_clock clock;
+
+    static timer_wheel &instance()
+    {
+        static timer_wheel wheel;
+        return wheel;
+    }
+
+    timer_wheel(const timer_wheel &)            = delete;
+    timer_wheel &operator=(const timer_wheel &) = delete;
+
+    ~timer_wheel()
+    {
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        if(thread_.joinable())
+            thread_.join();
+    }
+
+    // 在 delay 之后（向上取整到刻度）于定时线程上执行 fn
+    void schedule(std::chrono::nanoseconds delay, std::function<void()> fn)
+    {
+        std::uint64_t ticks = static_cast<std::uint64_t>(
+            (delay.count() + tick_ns - 1) / tick_ns);
+        if(ticks == 0)
+            ticks = 1;
+
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            std::uint64_t now = now_tick();
+            if(count_ == 0 && current_tick_ < now)
+                current_tick_ = now; // 轮为空，直接追上当前时间
+
+            // now_tick 向下取整，多加一个刻度保证不早于 delay 触发
+            entry e;
+            e.expires = (std::max)(now, current_tick_) + ticks + 1;
+            e.fn      = std::move(fn);
+            add_locked(std::move(e));
+            ++count_;
+        }
+        cv_.notify_one();
+    }
+
+private:
+    static const unsigned level_bits = 6;
+    static const unsigned levels     = 4;
+    static const std::uint64_t level_size = std::uint64_t(1) << level_bits;
+    static const std::uint64_t level_mask = level_size - 1;
+    static const long long tick_ns        = 1000000; // 1ms
+
+    struct entry
+    {
+        std::uint64_t expires;
+        std::function<void()> fn;
+    };
+
+    timer_wheel()
+        : epoch_(clock::now())
+        , current_tick_(0)
+        , count_(0)
+        , stop_(false)
+    {
+        thread_ = std::thread(&timer_wheel::run, this);
+    }
+
+    std::uint64_t now_tick() const
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - epoch_).count() /
+            tick_ns);
+    }
+
+    void add_locked(entry e)
+    {
+        std::uint64_t delta = e.expires > current_tick_ ? e.expires - current_tick_ : 0;
+        for(unsigned level = 0; level < levels; ++level)
+        {
+            if(delta < (std::uint64_t(1) << (level_bits * (level + 1))) || level + 1 == levels)
+            {
+                // 超出最高层范围的定时器放入最高层，下沉时会再次判断
+                std::uint64_t at = e.expires;
+                if(level + 1 == levels && delta >= (std::uint64_t(1) << (level_bits * levels)))
+                    at = current_tick_ + (std::uint64_t(1) << (level_bits * levels)) - 1;
+                std::size_t idx = static_cast<std::size_t>((at >> (level_bits * level)) & level_mask);
+                wheel_[level][idx].push_back(std::move(e));
+                return;
+            }
+        }
+    }
+
+    // 下一次需要醒来的刻度：第 0 层取最近的非空槽，更高层取最低非空层的下沉点
+    std::uint64_t next_event_tick_locked() const
+    {
+        std::uint64_t next = current_tick_ + level_size;
+        for(std::uint64_t t = current_tick_ + 1; t < current_tick_ + level_size; ++t)
+        {
+            if(!wheel_[0][t & level_mask].empty())
+            {
+                next = t;
+                break;
+            }
+        }
+        for(unsigned level = 1; level < levels; ++level)
+        {
+            bool has = false;
+            for(std::size_t i = 0; i < level_size && !has; ++i)
+                has = !wheel_[level][i].empty();
+            if(!has)
+                continue;
+
+            std::uint64_t span = std::uint64_t(1) << (level_bits * level);
+            next = (std::min)(next, (current_tick_ / span + 1) * span);
+            break;
+        }
+        return next;
+    }
+
+    void cascade_locked(unsigned level)
+    {
+        std::size_t idx = static_cast<std::size_t>(
+            (current_tick_ >> (level_bits * level)) & level_mask);
+        std::vector<entry> moved;
+        moved.swap(wheel_[level][idx]);
+        for(auto &e : moved)
+            add_locked(std::move(e));
+    }
+
+    void advance_locked(std::vector<entry> &due)
+    {
+        ++current_tick_;
+        // 低位全为 0 的层需要下沉，先由高到低逐级下沉，再触发第 0 层当前槽
+        unsigned top = 0;
+        while(top + 1 < levels &&
+              (current_tick_ & ((std::uint64_t(1) << (level_bits * (top + 1))) - 1)) == 0)
+        {
+            ++top;
+        }
+        for(unsigned level = top; level >= 1; --level)
+            cascade_locked(level);
+
+        auto &bucket = wheel_[0][current_tick_ & level_mask];
+        if(bucket.empty())
+            return;
+
+        std::vector<entry> fired;
+        fired.swap(bucket);
+        for(auto &e : fired)
+        {
+            if(e.expires > current_tick_)
+                add_locked(std::move(e));
+            else
+                due.push_back(std::move(e));
+        }
+    }
+
+    void run()
+    {
+        std::vector<entry> due;
+        std::unique_lock<std::mutex> lk(mutex_);
+        while(!stop_)
+        {
+            if(count_ == 0)
+            {
+                cv_.wait(lk);
+                continue;
+            }
+
+            std::uint64_t target = now_tick();
+            if(current_tick_ >= target)
+            {
+                std::uint64_t next = next_event_tick_locked();
+                cv_.wait_until(lk, epoch_ + std::chrono::nanoseconds(
+                                                static_cast<long long>(next) * tick_ns));
+                continue;
+            }
+
+            while(current_tick_ < target)
+                advance_locked(due);
+            if(due.empty())
+                continue;
+
+            count_ -= due.size();
+            lk.unlock();
+            for(auto &e : due)
+            {
+                try
+                {
+                    e.fn();
+                }
+                catch(...)
+                {
+                    // 异常吞噬，保证定时线程存活
+                }
+            }
+            due.clear();
+            lk.lock();
+        }
+    }
+
+    clock::time_point epoch_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<entry> wheel_[levels][level_size];
+    std::uint64_t current_tick_;
+    std::size_t count_;
+    bool stop_;
+    std::thread thread_;
+};
+
+// ============================================================================
+// wait_word：等待“某个条件成立”的轻量唤醒原语
+// Linux 上直接使用 futex，其他平台退化为 mutex + condition_variable
+// 通知方在没有等待者时只付出一次 fence 与一次读取
+// ============================================================================
+class wait_word
+{
+public:
+    typedef std::chrono::steady_clock clock;
+
+    wait_word()
+        : value_(0)
+        , waiters_(0)
+    {
+    }
+
+    wait_word(const wait_word &)            = delete;
+    wait_word &operator=(const wait_word &) = delete;
+
+    // now + timeout，超出 time_point 表示范围时视为永不超时
+    template <typename Rep, typename Period>
+    static clock::time_point deadline_after(const std::chrono::duration<Rep, Period> &timeout)
+    {
+        clock::time_point now = clock::now();
+        std::chrono::duration<double> limit = clock::time_point::max() - now;
+        if(std::chrono::duration<double>(timeout) >= limit)
+            return clock::time_point::max();
+        return now + std::chrono::duration_cast<clock::duration>(timeout);
+    }
+
+    // 阻塞直到 ready() 为真或到达 deadline，返回最终的 ready() 结果
+    // ready() 读取的状态必须在调用 notify_all() 之前发布
+    template <typename Pred>
+    bool wait_until(Pred ready, clock::time_point deadline)
+    {
+        while(!ready())
+        {
+            waiters_.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::uint32_t seen = value_.load(std::memory_order_acquire);
+            if(ready())
+            {
+                waiters_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            bool timed_out = !block(seen, deadline);
+            waiters_.fetch_sub(1, std::memory_order_relaxed);
+            if(timed_out)
+                return ready();
+        }
+        return true;
+    }
+
+    void notify_all()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(waiters_.load(std::memory_order_relaxed) == 0)
+            return;
+        value_.fetch_add(1, std::memory_order_release);
+        wake();
+    }
+
+private:
+#if defined(__linux__)
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(int),
+                  "futex word must be 32 bits");
+
+    int *word() { return reinterpret_cast<int *>(&value_); }
+
+    // 返回 false 表示已到 deadline
+    bool block(std::uint32_t seen, clock::time_point deadline)
+    {
+        struct timespec ts;
+        struct timespec *timeout = nullptr;
+        if(deadline != clock::time_point::max())
+        {
+            auto now = clock::now();
+            if(now >= deadline)
+                return false;
+            auto ns    = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count();
+            ts.tv_sec  = static_cast<time_t>(ns / 1000000000);
+            ts.tv_nsec = static_cast<long>(ns % 1000000000);
+            timeout    = &ts;
+        }
+        syscall(SYS_futex, word(), FUTEX_WAIT_PRIVATE, static_cast<int>(seen), timeout, nullptr, 0);
+        return deadline == clock::time_point::max() || clock::now() < deadline;
+    }
+
+    void wake()
+    {
+        syscall(SYS_futex, word(), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+#else
+    bool block(std::uint32_t seen, clock::time_point deadline)
+    {
+        std::unique_lock<std::mutex> lk(mutex_);
+        auto changed = [this, seen]() { return value_.load(std::memory_order_acquire) != seen; };
+        if(deadline == clock::time_point::max())
+        {
+            cv_.wait(lk, changed);
+            return true;
+        }
+        return cv_.wait_until(lk, deadline, changed);
+    }
+
+    void wake()
+    {
+        // 空临界区：保证等待者要么尚未检查值，要么已进入 wait
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+        }
+        cv_.notify_all();
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+#endif
+
+    std::atomic<std::uint32_t> value_;   // 每次有等待者时的通知递增
+    std::atomic<std::uint32_t> waiters_; // 正在等待的线程数
+};
+
+// 把限流后的调用交给内层投递策略（排队等），没有内层时直接调用槽
+template <typename... Args>
+struct forward_to_inner
+{
+    slot_dispatcher<Args...> *inner;
+    const std::shared_ptr<slot<Args...>> *s;
+
+    void operator()(Args &... args) const
+    {
+        if(inner)
+            inner->dispatch(*s, args...);
+        else
+            (*s)->call(args...);
+    }
+};
+
+// ============================================================================
+// 节流：前沿触发，被抑制的发射只有一次时间戳读取与比较
+// ============================================================================
+template <typename... Args>
+class throttle_dispatcher : public slot_dispatcher<Args...>
+{
+public:
+    using slot_ptr = std::shared_ptr<slot<Args...>>;
+
+    throttle_dispatcher(std::shared_ptr<slot_dispatcher<Args...>> inner,
+                        std::chrono::nanoseconds interval)
+        : inner_(std::move(inner))
+        , interval_ns_(interval.count())
+        , next_ns_((std::numeric_limits<long long>::min)())
+    {
+    }
+
+    void dispatch(const slot_ptr &s, Args &... args) override
+    {
+        long long now  = steady_now_ns();
+        long long next = next_ns_.load(std::memory_order_relaxed);
+        if(now < next)
+            return;
+        if(!next_ns_.compare_exchange_strong(next, now + interval_ns_,
+                                             std::memory_order_relaxed))
+            return; // 其他线程抢到了本周期
+
+        forward_to_inner<Args...> call = {inner_.get(), &s};
+        call(args...);
+    }
+
+    bool query_queue(queue_stats_t &out) const override
+    {
+        return inner_ && inner_->query_queue(out);
+    }
+
+    bool query_cost(slot_cost_t &out) const override
+    {
+        return inner_ && inner_->query_cost(out);
+    }
+
+    std::size_t memory_usage() const override
+    {
+        return sizeof(*this) + shared_block_overhead + (inner_ ? inner_->memory_usage() : 0);
+    }
+
+private:
+    std::shared_ptr<slot_dispatcher<Args...>> inner_;
+    long long interval_ns_;
+    std::atomic<long long> next_ns_;
+};
+
+// ============================================================================
+// 防抖：每次发射只刷新最新参数与时间戳，定时轮到期后确认安静期再交付
+// ============================================================================
+template <typename... Args>
+class debounce_dispatcher
+    : public slot_dispatcher<Args...>
+    , public std::enable_shared_from_this<debounce_dispatcher<Args...>>
+{
+public:
+    using slot_ptr   = std::shared_ptr<slot<Args...>>;
+    using args_tuple = std::tuple<typename std::decay<Args>::type...>;
+
+    debounce_dispatcher(std::shared_ptr<slot_dispatcher<Args...>> inner,
+                        std::chrono::nanoseconds delay)
+        : inner_(std::move(inner))
+        , delay_ns_(delay.count())
+        , last_ns_(0)
+        , armed_(false)
+    {
+        latest_.reserve(1);
+    }
+
+    void dispatch(const slot_ptr &s, Args &... args) override
+    {
+        store_latest(no_args(), args...);
+
+        // 快路径：定时器已在等待时只刷新最新值与时间戳，不再碰定时轮
+        if(armed_.load())
+            return;
+        bool expected = false;
+        if(armed_.compare_exchange_strong(expected, true))
+            arm(s, std::chrono::nanoseconds(delay_ns_));
+    }
+
+    bool query_queue(queue_stats_t &out) const override
+    {
+        return inner_ && inner_->query_queue(out);
+    }
+
+    bool query_cost(slot_cost_t &out) const override
+    {
+        return inner_ && inner_->query_cost(out);
+    }
+
+    std::size_t memory_usage() const override
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return sizeof(*this) + shared_block_overhead + latest_.capacity() * sizeof(args_tuple) +
+               (inner_ ? inner_->memory_usage() : 0);
+    }
+
+private:
+    void arm(const slot_ptr &s, std::chrono::nanoseconds delay)
+    {
+        std::shared_ptr<debounce_dispatcher> self = this->shared_from_this();
+        slot_ptr target                           = s;
+        timer_wheel::instance().schedule(delay, [self, target]() { self->fire(target); });
+    }
+
+    typedef std::integral_constant<bool, sizeof...(Args) == 0> no_args;
+
+    // 无参数时没有需要发布的值，刷新时间戳即可，无需加锁
+    void store_latest(std::true_type)
+    {
+        last_ns_.store(steady_now_ns());
+    }
+
+    // 最新参数与时间戳在同一临界区内更新，fire() 据此判断取出的值是否已度过安静期
+    void store_latest(std::false_type, Args &... args)
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if(latest_.empty())
+            latest_.emplace_back(args...);
+        else
+            latest_.front() = args_tuple(args...);
+        last_ns_.store(steady_now_ns(), std::memory_order_relaxed);
+    }
+
+    void fire(const slot_ptr &s)
+    {
+        long long last      = last_ns_.load();
+        long long remaining = last + delay_ns_ - steady_now_ns();
+        if(remaining > 0)
+        {
+            // 期间又有发射，按剩余的安静期重新计时
+            arm(s, std::chrono::nanoseconds(remaining));
+            return;
+        }
+
+        armed_.store(false);
+        if(deliver_latest(s, last, no_args()))
+            return;
+
+        // 清除标志前后又有发射：发射方可能看到标志仍在而没有计时，由这里补上
+        bool expected = false;
+        if(armed_.compare_exchange_strong(expected, true))
+            arm(s, std::chrono::nanoseconds(delay_ns_));
+    }
+
+    // 时间戳自 fire() 读取后未变时交付并返回 true
+    bool deliver_latest(const slot_ptr &s, long long last, std::true_type)
+    {
+        if(last_ns_.load() != last)
+            return false;
+        args_tuple item;
+        deliver(s, item);
+        return true;
+    }
+
+    bool deliver_latest(const slot_ptr &s, long long last, std::false_type)
+    {
+        std::unique_lock<std::mutex> lk(mutex_);
+        if(last_ns_.load(std::memory_order_relaxed) != last)
+            return false;
+        if(latest_.empty())
+            return true;
+        args_tuple item(std::move(latest_.front()));
+        latest_.clear();
+        lk.unlock();
+        deliver(s, item);
+        return true;
+    }
+
+    void deliver(const slot_ptr &s, args_tuple &item)
+    {
+        if(!s->is_deliverable())
+            return;
+
+        forward_to_inner<Args...> call = {inner_.get(), &s};
+        try
+        {
+            emission_scope scope; // 在定时线程上调用槽时同样隔离停止标志
+            apply_tuple(call, item);
+        }
+        catch(...)
+        {
+            // 异常吞噬，与同步发射保持一致
+        }
+    }
+
+    std::shared_ptr<slot_dispatcher<Args...>> inner_;
+    long long delay_ns_;
+    mutable std::mutex mutex_;
+    std::vector<args_tuple> latest_; // 长度不超过 1，容量常驻避免重复分配
+    std::atomic<long long> last_ns_;
+    std::atomic<bool> armed_; // 已有定时器在等待
+};
+
+// ============================================================================
+// 线程亲和：所属线程发射时直接调用，其他线程发射时排队到所属线程的本地队列
+// ============================================================================
+template <typename... Args>
+class affinity_dispatcher : public slot_dispatcher<Args...>
+{
+public:
+    using slot_ptr = std::shared_ptr<slot<Args...>>;
+
+    // 在执行 connect 的线程上构造
+    affinity_dispatcher(std::size_t capacity, overflow_t overflow)
+        : owner_(std::this_thread::get_id())
+        , queued_(std::make_shared<queued_dispatcher<Args...>>(this_thread_loop(), false,
+                                                               capacity, overflow))
+    {
+    }
+
+    void dispatch(const slot_ptr &s, Args &... args) override
+    {
+        if(std::this_thread::get_id() == owner_)
+            s->call(args...);
+        else
+            queued_->dispatch(s, args...);
+    }
+
+    bool query_queue(queue_stats_t &out) const override
+    {
+        return queued_->query_queue(out);
+    }
+
+    std::size_t memory_usage() const override
+    {
+        return sizeof(*this) + shared_block_overhead + queued_->memory_usage();
+    }
+
+private:
+    std::thread::id owner_;
+    std::shared_ptr<queued_dispatcher<Args...>> queued_;
+};
+
+// ============================================================================
+// 耗时预算：测量每次同步调用，维护指数移动平均（权重 1/8）
+// 前 cost_warmup_samples 次调用为预热窗口，以其中的最小值作为平均值初值，
+// 单次冷启动（缓存未命中、缺页、延迟初始化）不会让槽被标记或迁移；
+// 平均值超出预算时标记为慢槽；设置了 offload 执行器时，之后的发射改为排队执行
+// ============================================================================
+static const unsigned cost_warmup_samples = 8;
+
+template <typename... Args>
+class cost_dispatcher : public slot_dispatcher<Args...>
+{
+public:
+    using slot_ptr = std::shared_ptr<slot<Args...>>;
+
+    cost_dispatcher(std::chrono::nanoseconds budget, const std::shared_ptr<executor_t> &offload)
+        : budget_ns_(budget.count())
+        , average_ns_(-1)
+        , warmup_min_ns_((std::numeric_limits<long long>::max)())
+        , samples_(0)
+        , slow_(false)
+        , offloaded_(false)
+    {
+        if(offload)
+            offload_ = std::make_shared<queued_dispatcher<Args...>>(offload, false);
+    }
+
+    void dispatch(const slot_ptr &s, Args &... args) override
+    {
+        if(offloaded_.load(std::memory_order_acquire))
+        {
+            offload_->dispatch(s, args...);
+            return;
+        }
+
+        long long start = steady_now_ns();
+        s->call(args...);
+        record(steady_now_ns() - start);
+    }
+
+    bool query_queue(queue_stats_t &out) const override
+    {
+        return offload_ && offload_->query_queue(out);
+    }
+
+    bool query_cost(slot_cost_t &out) const override
+    {
+        long long avg = average_ns_.load(std::memory_order_relaxed);
+        out.average   = std::chrono::nanoseconds(avg < 0 ? 0 : avg);
+        out.budget    = std::chrono::nanoseconds(budget_ns_);
+        out.slow      = slow_.load(std::memory_order_relaxed);
+        out.offloaded = offloaded_.load(std::memory_order_relaxed);
+        return true;
+    }
+
+    std::size_t memory_usage() const override
+    {
+        return sizeof(*this) + shared_block_overhead + (offload_ ? offload_->memory_usage() : 0);
+    }
+
+private:
+    // 并发发射时的更新可能互相覆盖，平均值仍然收敛，不值得为此加锁或 CAS
+    void record(long long sample)
+    {
+        long long avg = average_ns_.load(std::memory_order_relaxed);
+        if(avg < 0)
+        {
+            // 预热：只记录最小值，窗口结束时作为平均值初值
+            long long low = warmup_min_ns_.load(std::memory_order_relaxed);
+            while(sample < low &&
+                  !warmup_min_ns_.compare_exchange_weak(low, sample, std::memory_order_relaxed))
+            {
+            }
+            if(samples_.fetch_add(1, std::memory_order_relaxed) + 1 < cost_warmup_samples)
+                return;
+            avg = warmup_min_ns_.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            avg = avg + (sample - avg) / 8;
+        }
+        average_ns_.store(avg, std::memory_order_relaxed);
+
+        bool over = avg > budget_ns_;
+        if(over != slow_.load(std::memory_order_relaxed))
+            slow_.store(over, std::memory_order_relaxed);
+        if(over && offload_)
+            offloaded_.store(true, std::memory_order_release);
+    }
+
+    long long budget_ns_;
+    std::atomic<long long> average_ns_;    // -1 表示仍在预热
+    std::atomic<long long> warmup_min_ns_; // 预热窗口内的最小耗时
+    std::atomic<unsigned> samples_;        // 预热窗口内的样本数
+    std::atomic<bool> slow_;
+    std::atomic<bool> offloaded_; // 一旦迁移不再回到同步调用
+    std::shared_ptr<queued_dispatcher<Args...>> offload_;
+};
+
+// 按连接选项组装投递策略：排队在内层，限流在外层
+template <typename... Args>
+std::shared_ptr<slot_dispatcher<Args...>> make_slot_dispatcher(const connect_options_t &options,
+                                                               slot<Args...> *)
+{
+    std::shared_ptr<slot_dispatcher<Args...>> d;
+    if(options.is_thread_affine())
+        d = std::make_shared<affinity_dispatcher<Args...>>(options.capacity(), options.overflow());
+    else if(options.is_queued())
+        d = std::make_shared<queued_dispatcher<Args...>>(options.executor(), options.is_coalesced(),
+                                                         options.capacity(), options.overflow());
+    else if(options.budget().count() > 0)
+        d = std::make_shared<cost_dispatcher<Args...>>(options.budget(), options.offload());
+
+    switch(options.rate_limit())
+    {
+    case rate_limit_t::throttle:
+        d = std::make_shared<throttle_dispatcher<Args...>>(d, options.rate_interval());
+        break;
+    case rate_limit_t::debounce:
+        d = std::make_shared<debounce_dispatcher<Args...>>(d, options.rate_interval());
+        break;
+    case rate_limit_t::none:
+        break;
+    }
+    return d;
+}
+
+// 返回值信号的槽总是在发射线程中同步调用
+template <typename R, typename... Args>
+std::shared_ptr<slot_dispatcher<R(Args...)>> make_slot_dispatcher(const connect_options_t &,
+                                                                  slot<R(Args...)> *)
+{
+    return std::shared_ptr<slot_dispatcher<R(Args...)>>();
+}
+
+inline bool is_synchronous(const connect_options_t &options)
+{
+    return !options.is_queued() && !options.is_thread_affine() &&
+           options.rate_limit() == rate_limit_t::none && options.budget().count() == 0;
+}
+
+// 成员函数指针检测
+template <typename T>
+struct is_member_function_pointer : std::false_type
+{
+};
+
+template <typename C, typename R, typename... A>
+struct is_member_function_pointer<R (C::*)(A...)> : std::true_type
+{
+};
+
+template <typename C, typename R, typename... A>
+struct is_member_function_pointer<R (C::*)(A...) const> : std::true_type
+{
+};
+
+// 名称驻留：返回的指针在进程生命周期内有效，可被追踪记录等直接保存
+// 驻留的名称从不释放，内存随不同名称的数量增长
+inline const char *intern_name(const std::string &name)
+{
+    static std::mutex mutex;
+    static std::set<std::string> *names = new std::set<std::string>(); // 不析构，避免退出顺序问题
+    std::lock_guard<std::mutex> lk(mutex);
+    return names->insert(name).first->c_str();
+}
+
+} // namespace detail
+
+// ============================================================================
+// 发射追踪（定义 XSWL_SIGNALS_TRACING 时编译）
+// 记录每次发射与每个槽调用的起止时间到线程本地环形缓冲区，导出为 Chrome trace-event JSON
+// （chrome://tracing 与 Perfetto 均可打开）；未定义宏时钩子展开为空语句
+// ============================================================================
+#if defined(XSWL_SIGNALS_TRACING)
+
+namespace trace {
+namespace detail {
+
+enum event_kind
+{
+    emit_event = 0,
+    slot_event = 1
+};
+
+// 环形缓冲区中的一条记录；字段均为 relaxed 原子量，
+// seq 为奇数表示正在写入，导出线程按顺序锁的方式读取
+struct event
+{
+    std::atomic<std::uint64_t> seq;
+    std::atomic<const char *> name;
+    std::atomic<std::uintptr_t> object; // 发射为信号状态地址，槽调用为槽地址
+    std::atomic<int> kind;
+    std::atomic<std::uint32_t> tid; // 写入时的线程编号；缓冲区被其他线程复用后旧记录仍归属原线程
+    std::atomic<long long> start_ns;
+    std::atomic<long long> dur_ns;
+};
+
+// 单写者环形缓冲区：只有所属线程写入，写满后覆盖最旧的记录；
+// 线程退出后缓冲区标记为空闲，由之后首次记录的线程复用
+class ring
+{
+public:
+    ring(std::size_t capacity, std::uint32_t tid)
+        : in_use(true)
+        , events_(new event[capacity]())
+        , capacity_(capacity)
+        , head_(0)
+        , tid_(tid)
+    {
+    }
+
+    // 由新线程接管（调用方持有 registry 的互斥量）
+    void adopt(std::uint32_t tid)
+    {
+        in_use = true;
+        tid_   = tid;
+        thread_name.clear();
+    }
+
+    void record(const char *name, const void *object, event_kind kind, long long start,
+                long long dur)
+    {
+        std::uint64_t h = head_.load(std::memory_order_relaxed);
+        event &e        = events_[h % capacity_];
+        std::uint64_t s = e.seq.load(std::memory_order_relaxed);
+        e.seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        e.name.store(name, std::memory_order_relaxed);
+        e.object.store(reinterpret_cast<std::uintptr_t>(object), std::memory_order_relaxed);
+        e.kind.store(kind, std::memory_order_relaxed);
+        e.tid.store(tid_, std::memory_order_relaxed);
+        e.start_ns.store(start, std::memory_order_relaxed);
+        e.dur_ns.store(dur, std::memory_order_relaxed);
+        e.seq.store(s + 2, std::memory_order_release);
+        head_.store(h + 1, std::memory_order_release);
+    }
+
+    struct snapshot_event
+    {
+        const char *name;
+        std::uintptr_t object;
+        int kind;
+        std::uint32_t tid;
+        long long start_ns;
+        long long dur_ns;
+    };
+
+    // 复制仍在缓冲区中的记录；读取期间被覆盖的记录被跳过
+    void collect(std::vector<snapshot_event> &out) const
+    {
+        std::uint64_t h    = head_.load(std::memory_order_acquire);
+        std::uint64_t from = h > capacity_ ? h - capacity_ : 0;
+        for(std::uint64_t i = from; i < h; ++i)
+        {
+            const event &e   = events_[i % capacity_];
+            std::uint64_t s1 = e.seq.load(std::memory_order_acquire);
+            if(s1 & 1)
+                continue;
+            snapshot_event item;
+            item.name     = e.name.load(std::memory_order_relaxed);
+            item.object   = e.object.load(std::memory_order_relaxed);
+            item.kind     = e.kind.load(std::memory_order_relaxed);
+            item.tid      = e.tid.load(std::memory_order_relaxed);
+            item.start_ns = e.start_ns.load(std::memory_order_relaxed);
+            item.dur_ns   = e.dur_ns.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(e.seq.load(std::memory_order_relaxed) != s1)
+                continue;
+            out.push_back(item);
+        }
+    }
+
+    std::uint32_t tid() const { return tid_; }
+    std::size_t capacity() const { return capacity_; }
+
+    // 以下两项由 registry 的互斥量保护
+    bool in_use;
+    std::string thread_name;
+
+private:
+    std::unique_ptr<event[]> events_;
+    std::size_t capacity_;
+    std::atomic<std::uint64_t> head_;
+    std::uint32_t tid_;
+};
+
+struct registry
+{
+    registry()
+        : active(false)
+        , capacity(16384)
+        , cutoff_ns(0)
+        , next_tid(0)
+    {
+    }
+
+    // 不析构：线程退出与静态析构的先后顺序不影响导出
+    static registry &instance()
+    {
+        static registry *r = new registry();
+        return *r;
+    }
+
+    std::atomic<bool> active;
+    std::atomic<std::size_t> capacity;  // 之后新建的线程缓冲区容量（记录数）
+    std::atomic<long long> cutoff_ns;   // clear() 之前的记录在导出时被忽略
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ring>> rings;
+    std::uint32_t next_tid;
+};
+
+// 线程本地的缓冲区所有权：线程退出时把缓冲区标记为空闲，登记表不随线程数增长
+struct ring_owner
+{
+    std::shared_ptr<ring> current;
+
+    ~ring_owner()
+    {
+        if(!current)
+            return;
+        registry &r = registry::instance();
+        std::lock_guard<std::mutex> lk(r.mutex);
+        current->in_use = false;
+    }
+};
+
+// 当前线程的缓冲区，首次记录时复用容量相同的空闲缓冲区或新建并登记
+inline ring &this_thread_ring()
+{
+    static thread_local ring_owner local;
+    if(!local.current)
+    {
+        registry &r = registry::instance();
+        std::lock_guard<std::mutex> lk(r.mutex);
+        const std::size_t capacity = (std::max)(std::size_t(1), r.capacity.load());
+        for(const auto &candidate : r.rings)
+        {
+            if(!candidate->in_use && candidate->capacity() == capacity)
+            {
+                candidate->adopt(++r.next_tid);
+                local.current = candidate;
+                break;
+            }
+        }
+        // 容量已改变的空闲缓冲区不会再被复用，直接释放
+        r.rings.erase(std::remove_if(r.rings.begin(), r.rings.end(),
+                                     [capacity](const std::shared_ptr<ring> &c) {
+                                         return !c->in_use && c->capacity() != capacity;
+                                     }),
+                      r.rings.end());
+        if(!local.current)
+        {
+            local.current = std::make_shared<ring>(capacity, ++r.next_tid);
+            r.rings.push_back(local.current);
+        }
+    }
+    return *local.current;
+}
+
+// 追踪作用域：构造时记下起始时间，析构时写入一条完整记录；未开启追踪时只有一次 relaxed 读取
+class scope
+{
+public:
+    scope(const char *name, const void *object, event_kind kind)
+        : name_(name)
+        , object_(object)
+        , kind_(kind)
+        , start_(registry::instance().active.load(std::memory_order_relaxed)
+                     ? ::xswl::detail::steady_now_ns()
+                     : -1)
+    {
+    }
+
+    ~scope()
+    {
+        if(start_ >= 0)
+            this_thread_ring().record(name_, object_, kind_, start_,
+                                      ::xswl::detail::steady_now_ns() - start_);
+    }
+
+    scope(const scope &)            = delete;
+    scope &operator=(const scope &) = delete;
+
+private:
+    const char *name_;
+    const void *object_;
+    event_kind kind_;
+    long long start_;
+};
+
+inline void append_json_string(std::string &out, const char *s)
+{
+    out += '"';
+    for(; *s; ++s)
+    {
+        unsigned char c = static_cast<unsigned char>(*s);
+        if(c == '"' || c == '\\')
+        {
+            out += '\\';
+            out += static_cast<char>(c);
+        }
+        else if(c < 0x20)
+        {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        }
+        else
+        {
+            out += static_cast<char>(c);
+        }
+    }
+    out += '"';
+}
+
+} // namespace detail
+
+// 开始记录；events_per_thread 非 0 时设置之后新建的线程缓冲区容量
+inline void start(std::size_t events_per_thread = 0)
+{
+    detail::registry &r = detail::registry::instance();
+    if(events_per_thread != 0)
+        r.capacity.store(events_per_thread);
+    r.active.store(true);
+}
+
+inline void stop()
+{
+    detail::registry::instance().active.store(false);
+}
+
+inline bool active()
+{
+    return detail::registry::instance().active.load(std::memory_order_relaxed);
+}
+
+// 丢弃到目前为止的记录（导出时忽略），不影响是否继续记录
+inline void clear()
+{
+    detail::registry::instance().cutoff_ns.store(::xswl::detail::steady_now_ns());
+}
+
+// 为当前线程命名，导出为 thread_name 元数据
+inline void set_thread_name(const std::string &name)
+{
+    detail::ring &ring   = detail::this_thread_ring();
+    detail::registry &r  = detail::registry::instance();
+    std::lock_guard<std::mutex> lk(r.mutex);
+    ring.thread_name = name;
+}
+
+// 导出为 Chrome trace-event JSON；时间戳为 steady_clock 微秒
+inline std::string export_chrome_json()
+{
+    detail::registry &r = detail::registry::instance();
+    std::vector<std::shared_ptr<detail::ring>> rings;
+    std::vector<std::string> thread_names;
+    {
+        std::lock_guard<std::mutex> lk(r.mutex);
+        rings = r.rings;
+        for(const auto &ring : rings)
+            thread_names.push_back(ring->thread_name);
+    }
+    const long long cutoff = r.cutoff_ns.load();
+
+    std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first      = true;
+    char buf[160];
+    std::vector<detail::ring::snapshot_event> events;
+    for(std::size_t i = 0; i < rings.size(); ++i)
+    {
+        // 元数据使用缓冲区当前所属线程的编号；事件各自带有写入时的编号
+        const std::uint32_t tid = rings[i]->tid();
+        if(!thread_names[i].empty())
+        {
+            out += first ? "" : ",";
+            first = false;
+            std::snprintf(buf, sizeof(buf),
+                          "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":",
+                          static_cast<unsigned>(tid));
+            out += buf;
+            detail::append_json_string(out, thread_names[i].c_str());
+            out += "}}";
+        }
+
+        events.clear();
+        rings[i]->collect(events);
+        for(const auto &e : events)
+        {
+            if(e.start_ns < cutoff)
+                continue;
+            const bool slot = e.kind == detail::slot_event;
+            out += first ? "" : ",";
+            first = false;
+            out += "{\"name\":";
+            detail::append_json_string(out, e.name ? e.name : "signal");
+            std::snprintf(buf, sizeof(buf),
+                          ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                          "\"ts\":%lld.%03lld,\"dur\":%lld.%03lld,\"args\":{\"%s\":\"0x%llx\"}}",
+                          slot ? "slot" : "emit", static_cast<unsigned>(e.tid),
+                          e.start_ns / 1000, e.start_ns % 1000, e.dur_ns / 1000, e.dur_ns % 1000,
+                          slot ? "slot" : "signal",
+                          static_cast<unsigned long long>(e.object));
+            out += buf;
+        }
+    }
+    out += "]}\n";
+    return out;
+}
+
+// 导出到文件，失败时返回 false
+inline bool write_chrome_json(const std::string &path)
+{
+    std::FILE *f = std::fopen(path.c_str(), "wb");
+    if(!f)
+        return false;
+    std::string json = export_chrome_json();
+    bool ok          = std::fwrite(json.data(), 1, json.size(), f) == json.size();
+    return std::fclose(f) == 0 && ok;
+}
+
+} // namespace trace
+
+    #define XSWL_SIGNALS_TRACE_EMIT(var, impl) \
+        ::xswl::trace::detail::scope var((impl).name(), &(impl), ::xswl::trace::detail::emit_event)
+    #define XSWL_SIGNALS_TRACE_SLOT(var, impl, sp) \
+        ::xswl::trace::detail::scope var((impl).name(), (sp), ::xswl::trace::detail::slot_event)
+#else
+    #define XSWL_SIGNALS_TRACE_EMIT(var, impl)     (void)0
+    #define XSWL_SIGNALS_TRACE_SLOT(var, impl, sp) (void)0
+#endif
+
+// ============================================================================
+// 采样剖析：每个线程以本地倒计数挑出约 1/N 的发射，记录扇出、发射耗时与最慢的槽，
+// 按信号汇总；未被采样的发射只有一次线程本地递减
+// ============================================================================
+namespace profiler {
+namespace detail {
+
+// 每个信号一份汇总，由信号持有，全局登记表只保存弱引用
+struct profile_block
+{
+    std::atomic<const char *> name{nullptr};
+    const void *signal = nullptr;
+    std::atomic<std::uint64_t> samples{0};
+    std::atomic<std::uint64_t> estimated_total{0}; // 各样本采样周期之和
+    std::atomic<std::uint64_t> fanout_total{0};
+    std::atomic<std::size_t> max_fanout{0};
+    std::atomic<long long> duration_total_ns{0};
+    std::atomic<long long> max_duration_ns{0};
+    std::atomic<long long> slowest_slot_ns{0};
+    std::atomic<const void *> slowest_slot{nullptr};
+    std::mutex slowest_mutex; // 只在出现更慢的槽时获取，保证槽地址与耗时成对更新
+
+    void reset()
+    {
+        samples.store(0, std::memory_order_relaxed);
+        estimated_total.store(0, std::memory_order_relaxed);
+        fanout_total.store(0, std::memory_order_relaxed);
+        max_fanout.store(0, std::memory_order_relaxed);
+        duration_total_ns.store(0, std::memory_order_relaxed);
+        max_duration_ns.store(0, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lk(slowest_mutex);
+        slowest_slot_ns.store(0, std::memory_order_relaxed);
+        slowest_slot.store(nullptr, std::memory_order_relaxed);
+    }
+};
+
+template <typename T>
+inline void store_max(std::atomic<T> &target, T value)
+{
+    T prev = target.load(std::memory_order_relaxed);
+    while(value > prev && !target.compare_exchange_weak(prev, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+// 采样周期，0 表示关闭；常量初始化，发射路径读取时不分配
+inline std::atomic<std::uint32_t> &sample_period()
+{
+    static std::atomic<std::uint32_t> period(0);
+    return period;
+}
+
+struct registry
+{
+    // 不析构：信号可能在静态析构阶段仍在发射
+    static registry &instance()
+    {
+        static registry *r = new registry();
+        return *r;
+    }
+
+    std::mutex mutex;
+    std::vector<std::weak_ptr<profile_block>> blocks;
+    std::size_t prune_at = 64; // 登记数达到该值时先清除已销毁信号的条目
+};
+
+// 关闭时倒计数按此周期重新检查开关
+static const std::uint32_t idle_period = 1024;
+
+struct thread_sampler
+{
+    std::uint32_t countdown = 1;
+    std::uint32_t rng       = 0x9e3779b9u;
+};
+
+inline thread_sampler &this_thread_sampler()
+{
+    static thread_local thread_sampler sampler;
+    return sampler;
+}
+
+// 倒计数到 0 时决定是否采样，并把下一次间隔设为 [N/2, 3N/2) 内的随机值，
+// 避免与周期性负载同步；返回本次采样所代表的周期，0 表示不采样
+inline std::uint32_t should_sample()
+{
+    thread_sampler &t = this_thread_sampler();
+    if(--t.countdown != 0)
+        return 0;
+    std::uint32_t period = sample_period().load(std::memory_order_relaxed);
+    if(period == 0)
+    {
+        t.countdown = idle_period;
+        return 0;
+    }
+    t.rng ^= t.rng << 13;
+    t.rng ^= t.rng >> 17;
+    t.rng ^= t.rng << 5;
+    t.countdown = period <= 1 ? 1 : period / 2 + t.rng % period;
+    return period;
+}
+
+inline std::shared_ptr<profile_block> make_block(const void *signal)
+{
+    auto block    = std::make_shared<profile_block>();
+    block->signal = signal;
+    registry &r   = registry::instance();
+    std::lock_guard<std::mutex> lk(r.mutex);
+    // 过期的弱引用仍占着整块分配：登记数翻倍时清除一次，不依赖 snapshot() 被调用
+    if(r.blocks.size() >= r.prune_at)
+    {
+        r.blocks.erase(std::remove_if(r.blocks.begin(), r.blocks.end(),
+                                      [](const std::weak_ptr<profile_block> &w) {
+                                          return w.expired();
+                                      }),
+                       r.blocks.end());
+        r.prune_at = (std::max)(std::size_t(64), r.blocks.size() * 2);
+    }
+    r.blocks.push_back(block);
+    return block;
+}
+
+// 一次被采样的发射：在栈上累计各槽耗时，析构时并入信号汇总
+class emit_sample
+{
+public:
+    emit_sample(profile_block *block, const char *name, long long start, std::uint32_t period)
+        : block_(block)
+        , start_(start)
+        , period_(period)
+        , fanout_(0)
+        , slowest_(nullptr)
+        , slowest_ns_(-1)
+    {
+        if(block_)
+            block_->name.store(name, std::memory_order_relaxed);
+    }
+
+    ~emit_sample()
+    {
+        if(!block_)
+            return;
+        long long duration = ::xswl::detail::steady_now_ns() - start_;
+        block_->samples.fetch_add(1, std::memory_order_relaxed);
+        block_->estimated_total.fetch_add(period_, std::memory_order_relaxed);
+        block_->fanout_total.fetch_add(fanout_, std::memory_order_relaxed);
+        store_max(block_->max_fanout, fanout_);
+        block_->duration_total_ns.fetch_add(duration, std::memory_order_relaxed);
+        store_max(block_->max_duration_ns, duration);
+        if(slowest_ns_ > block_->slowest_slot_ns.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lk(block_->slowest_mutex);
+            if(slowest_ns_ > block_->slowest_slot_ns.load(std::memory_order_relaxed))
+            {
+                block_->slowest_slot_ns.store(slowest_ns_, std::memory_order_relaxed);
+                block_->slowest_slot.store(slowest_, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool active() const { return block_ != nullptr; }
+
+    void slot(const void *s, long long ns)
+    {
+        ++fanout_;
+        if(ns > slowest_ns_)
+        {
+            slowest_ns_ = ns;
+            slowest_    = s;
+        }
+    }
+
+    emit_sample(const emit_sample &)            = delete;
+    emit_sample &operator=(const emit_sample &) = delete;
+
+private:
+    profile_block *block_;
+    long long start_;
+    std::uint32_t period_;
+    std::size_t fanout_;
+    const void *slowest_;
+    long long slowest_ns_;
+};
+
+} // namespace detail
+
+// 开始采样：每个线程平均每 every_n 次发射采样一次；调用线程的下一次发射即被采样，
+// 其他线程最多在 1024 次发射后开始采样
+inline void start(std::uint32_t every_n = 1000)
+{
+    detail::sample_period().store(every_n == 0 ? 1 : every_n);
+    detail::this_thread_sampler().countdown = 1;
+}
+
+inline void stop()
+{
+    detail::sample_period().store(0);
+}
+
+inline bool active()
+{
+    return detail::sample_period().load(std::memory_order_relaxed) != 0;
+}
+
+// 清零所有信号的汇总
+inline void reset()
+{
+    detail::registry &r = detail::registry::instance();
+    std::lock_guard<std::mutex> lk(r.mutex);
+    for(const auto &w : r.blocks)
+    {
+        if(auto block = w.lock())
+            block->reset();
+    }
+}
+
+// 所有至少被采样过一次且仍存活的信号的汇总，按估算的总发射耗时从高到低排列
+inline std::vector<emit_profile_t> snapshot()
+{
+    detail::registry &r = detail::registry::instance();
+    std::vector<std::shared_ptr<detail::profile_block>> blocks;
+    {
+        std::lock_guard<std::mutex> lk(r.mutex);
+        auto it = r.blocks.begin();
+        while(it != r.blocks.end())
+        {
+            if(auto block = it->lock())
+            {
+                blocks.push_back(std::move(block));
+                ++it;
+            }
+            else
+            {
+                it = r.blocks.erase(it);
+            }
+        }
+    }
+
+    std::vector<emit_profile_t> out;
+    for(const auto &block : blocks)
+    {
+        std::uint64_t samples = block->samples.load(std::memory_order_relaxed);
+        if(samples == 0)
+            continue;
+        emit_profile_t p;
+        const char *name      = block->name.load(std::memory_order_relaxed);
+        p.name                = name ? name : "";
+        p.signal              = block->signal;
+        p.samples             = samples;
+        p.estimated_emissions = block->estimated_total.load(std::memory_order_relaxed);
+        p.mean_fanout = static_cast<double>(block->fanout_total.load(std::memory_order_relaxed)) /
+                        static_cast<double>(samples);
+        p.max_fanout    = block->max_fanout.load(std::memory_order_relaxed);
+        p.mean_duration = std::chrono::nanoseconds(
+            block->duration_total_ns.load(std::memory_order_relaxed) / static_cast<long long>(samples));
+        p.max_duration =
+            std::chrono::nanoseconds(block->max_duration_ns.load(std::memory_order_relaxed));
+        {
+            std::lock_guard<std::mutex> lk(block->slowest_mutex);
+            p.slowest_slot          = block->slowest_slot.load(std::memory_order_relaxed);
+            p.slowest_slot_duration = std::chrono::nanoseconds(
+                block->slowest_slot_ns.load(std::memory_order_relaxed));
+        }
+        out.push_back(std::move(p));
+    }
+    std::stable_sort(out.begin(), out.end(), [](const emit_profile_t &a, const emit_profile_t &b) {
+        return a.mean_duration.count() * static_cast<double>(a.estimated_emissions) >
+               b.mean_duration.count() * static_cast<double>(b.estimated_emissions);
+    });
+    return out;
+}
+
+} // namespace profiler
+
+// ============================================================================
+// 全局信号登记表：信号通过 register_as() 自愿登记，快照列出各信号的连接数、
+// 发射频率、平均扇出与耗时以及内存占用；登记按信号地址分片加锁
+// ============================================================================
+namespace signal_registry {
+namespace detail {
+
+typedef void (*query_fn)(void *impl, signal_info_t &out);
+
+struct entry
+{
+    const void *key;
+    std::weak_ptr<void> impl;
+    query_fn query;
+    std::uint64_t last_emissions;
+    long long last_ns;
+};
+
+struct shard
+{
+    std::mutex mutex;
+    std::vector<entry> entries;
+};
+
+static const std::size_t shard_count = 16;
+
+// 不析构：信号可能在静态析构阶段才注销
+inline shard *shards()
+{
+    static shard *s = new shard[shard_count];
+    return s;
+}
+
+inline shard &shard_for(const void *key)
+{
+    return shards()[(reinterpret_cast<std::uintptr_t>(key) >> 6) % shard_count];
+}
+
+// registered 是信号自身的登记标志，只在分片锁内翻转：
+// 并发的登记与注销按加锁顺序生效，标志与登记表始终一致
+inline void add(const void *key, std::atomic<bool> &registered, std::weak_ptr<void> impl,
+                query_fn query)
+{
+    shard &sh = shard_for(key);
+    entry e   = {key, std::move(impl), query, 0, ::xswl::detail::steady_now_ns()};
+    std::lock_guard<std::mutex> lk(sh.mutex);
+    if(registered.load(std::memory_order_relaxed))
+        return;
+    sh.entries.push_back(std::move(e));
+    registered.store(true, std::memory_order_release);
+}
+
+inline void remove(const void *key, std::atomic<bool> &registered)
+{
+    shard &sh = shard_for(key);
+    std::lock_guard<std::mutex> lk(sh.mutex);
+    if(!registered.load(std::memory_order_relaxed))
+        return;
+    registered.store(false, std::memory_order_release);
+    for(std::size_t i = 0; i < sh.entries.size(); ++i)
+    {
+        if(sh.entries[i].key == key)
+        {
+            sh.entries[i] = std::move(sh.entries.back());
+            sh.entries.pop_back();
+            return;
+        }
+    }
+}
+
+} // namespace detail
+
+// 登记的信号数
+inline std::size_t size()
+{
+    std::size_t n = 0;
+    for(std::size_t i = 0; i < detail::shard_count; ++i)
+    {
+        detail::shard &sh = detail::shards()[i];
+        std::lock_guard<std::mutex> lk(sh.mutex);
+        n += sh.entries.size();
+    }
+    return n;
+}
+
+// 所有登记信号的当前状态，按名称排序；发射频率以两次快照之间的间隔计算
+inline std::vector<signal_info_t> snapshot()
+{
+    struct pending
+    {
+        std::shared_ptr<void> impl;
+        detail::query_fn query;
+        std::uint64_t last_emissions;
+        long long last_ns;
+    };
+
+    std::vector<signal_info_t> out;
+    for(std::size_t i = 0; i < detail::shard_count; ++i)
+    {
+        // 先在分片锁内取得强引用，查询在锁外进行：查询需要信号自身的锁，
+        // 且最后一个引用在此释放时信号析构会再次获取分片锁
+        std::vector<pending> items;
+        detail::shard &sh = detail::shards()[i];
+        {
+            std::lock_guard<std::mutex> lk(sh.mutex);
+            for(const auto &e : sh.entries)
+            {
+                pending p = {e.impl.lock(), e.query, e.last_emissions, e.last_ns};
+                if(p.impl)
+                    items.push_back(std::move(p));
+            }
+        }
+
+        for(auto &item : items)
+        {
+            signal_info_t info;
+            item.query(item.impl.get(), info);
+            long long now     = ::xswl::detail::steady_now_ns();
+            long long elapsed = now - item.last_ns;
+            info.emission_rate =
+                elapsed > 0 ? static_cast<double>(info.emissions - item.last_emissions) * 1e9 /
+                                  static_cast<double>(elapsed)
+                            : 0.0;
+
+            // 只在基线仍是本次读到的那一份时推进：并发的快照各自按同一基线计算频率，
+            // 较慢的调用者不会把较新的基线回退
+            std::lock_guard<std::mutex> lk(sh.mutex);
+            for(auto &e : sh.entries)
+            {
+                if(e.key == info.signal)
+                {
+                    if(e.last_ns == item.last_ns)
+                    {
+                        e.last_emissions = info.emissions;
+                        e.last_ns        = now;
+                    }
+                    break;
+                }
+            }
+            out.push_back(std::move(info));
+        }
+    }
+
+    std::stable_sort(out.begin(), out.end(), [](const signal_info_t &a, const signal_info_t &b) {
+        return a.name < b.name;
+    });
+    return out;
+}
+
+} // namespace signal_registry
+
+namespace detail {
+
+#if defined(XSWL_SIGNALS_LOCK_STATS)
+// 带竞争统计的互斥量：先 try_lock，失败时计时等待；计数在持锁期间以 relaxed 原子量更新
+class instrumented_mutex
+{
+public:
+    instrumented_mutex()
+        : acquisitions_(0)
+        , contended_(0)
+        , wait_ns_(0)
+        , max_wait_ns_(0)
+    {
+    }
+
+    void lock()
+    {
+        if(!mutex_.try_lock())
+        {
+            long long start = steady_now_ns();
+            mutex_.lock();
+            long long waited = steady_now_ns() - start;
+            contended_.fetch_add(1, std::memory_order_relaxed);
+            wait_ns_.fetch_add(waited, std::memory_order_relaxed);
+            if(waited > max_wait_ns_.load(std::memory_order_relaxed))
+                max_wait_ns_.store(waited, std::memory_order_relaxed);
+        }
+        acquisitions_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool try_lock()
+    {
+        if(!mutex_.try_lock())
+            return false;
+        acquisitions_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void unlock() { mutex_.unlock(); }
+
+    lock_stats_t stats() const
+    {
+        lock_stats_t out = {acquisitions_.load(std::memory_order_relaxed),
+                            contended_.load(std::memory_order_relaxed),
+                            std::chrono::nanoseconds(wait_ns_.load(std::memory_order_relaxed)),
+                            std::chrono::nanoseconds(max_wait_ns_.load(std::memory_order_relaxed))};
+        return out;
+    }
+
+    void reset()
+    {
+        acquisitions_.store(0, std::memory_order_relaxed);
+        contended_.store(0, std::memory_order_relaxed);
+        wait_ns_.store(0, std::memory_order_relaxed);
+        max_wait_ns_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::mutex mutex_;
+    std::atomic<std::uint64_t> acquisitions_;
+    std::atomic<std::uint64_t> contended_;
+    std::atomic<long long> wait_ns_;
+    std::atomic<long long> max_wait_ns_; // 只在持锁时写入
+};
+
+using signal_mutex = instrumented_mutex;
+#else
+using signal_mutex = std::mutex;
+#endif
+
+struct connection_tag
+{
+    explicit connection_tag(std::string n)
+        : name(std::move(n)) {}
+    std::string name;
+};
+
+// ============================================================================
+// 信号内部实现（共享状态）
+// ============================================================================
+template <typename... Args>
+class signal_impl
+{
+public:
+    using slot_type  = slot<Args...>;
+    using slot_ptr   = std::shared_ptr<slot_type>;
+    using args_tuple = typename slot_signature<Args...>::args_tuple;
+
+    signal_mutex mutex_;
+    std::vector<slot_ptr> slots_;
+    std::vector<std::shared_ptr<connection_tag>> tags_;
+    bool dirty_ = false; // 是否需要清理 or 重排
+
+    // 发射使用的只读快照（写时复制）：槽表变化后的首次发射重建，
+    // 之后的发射只复制 shared_ptr，不再分配
+    std::shared_ptr<const std::vector<slot_ptr>> snapshot_;
+
+    // 驻留后的信号名称；未命名时为空指针
+    std::atomic<const char *> name_{nullptr};
+
+    // 采样剖析汇总：首次被采样时创建，由 mutex_ 保护
+    std::shared_ptr<profiler::detail::profile_block> profile_;
+
+    // 全局登记：登记后才统计发射次数；只在登记表的分片锁内翻转
+    std::atomic<bool> registered_{false};
+    std::atomic<std::uint64_t> emissions_{0};
+
+    ~signal_impl()
+    {
+        if(registered_.load(std::memory_order_acquire))
+            signal_registry::detail::remove(this, registered_);
+    }
+
+    // 登记表查询入口（类型擦除）
+    static void query_info(void *p, signal_info_t &out)
+    {
+        signal_impl *impl = static_cast<signal_impl *>(p);
+        const char *n     = impl->name();
+        out.name          = n ? n : "";
+        out.signal        = impl;
+        out.emissions     = impl->emissions_.load(std::memory_order_relaxed);
+        out.memory        = impl->memory_usage();
+        out.slot_count    = 0;
+
+        out.mean_fanout        = 0.0;
+        out.mean_emit_duration = std::chrono::nanoseconds(0);
+
+        std::shared_ptr<profiler::detail::profile_block> profile;
+        {
+            std::lock_guard<signal_mutex> lk(impl->mutex_);
+            for(const auto &s : impl->slots_)
+            {
+                if(s && !s->pending_removal.load(std::memory_order_acquire))
+                    ++out.slot_count;
+            }
+            profile = impl->profile_;
+        }
+        std::uint64_t samples = profile ? profile->samples.load(std::memory_order_relaxed) : 0;
+        if(samples)
+        {
+            out.mean_fanout =
+                static_cast<double>(profile->fanout_total.load(std::memory_order_relaxed)) /
+                static_cast<double>(samples);
+            out.mean_emit_duration = std::chrono::nanoseconds(
+                profile->duration_total_ns.load(std::memory_order_relaxed) /
+                static_cast<long long>(samples));
+        }
+    }
+
+    // 是否为槽收集调用统计；由 mutex_ 保护，新连接据此创建计数器
+    bool stats_enabled_ = false;
+
+    void enable_slot_stats_locked(const slot_ptr &s)
+    {
+        slot_stats_counters *st = s->stats.load(std::memory_order_relaxed);
+        if(st)
+            st->enabled.store(stats_enabled_, std::memory_order_relaxed);
+        else if(stats_enabled_)
+            s->stats.store(new slot_stats_counters(), std::memory_order_release);
+    }
+
+    const char *name() const { return name_.load(std::memory_order_relaxed); }
+
+    // 等待下一次发射：等待者节点位于等待线程的栈上，由发射线程填写参数并唤醒
+    struct emission_waiter
+    {
+        args_tuple *out;
+        std::atomic<bool> fired;
+        emission_waiter *next;
+    };
+
+    // 阻塞直到下一次发射完成或到达 deadline；out 非空时写入该次发射的参数
+    bool wait_emission(args_tuple *out, wait_word::clock::time_point deadline)
+    {
+        emission_waiter self;
+        self.out = out;
+        self.fired.store(false, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lk(wait_mutex_);
+            self.next = waiters_;
+            waiters_  = &self;
+            // seq_cst 登记与 notify_waiters() 中的栅栏配对，见下
+            waiting_.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        emitted_.wait_until([&self]() { return self.fired.load(std::memory_order_acquire); },
+                            deadline);
+
+        std::lock_guard<std::mutex> lk(wait_mutex_);
+        if(self.fired.load(std::memory_order_relaxed))
+            return true;
+
+        // 超时：从链表中摘除自己
+        for(emission_waiter **link = &waiters_; *link; link = &(*link)->next)
+        {
+            if(*link == &self)
+            {
+                *link = self.next;
+                break;
+            }
+        }
+        waiting_.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // 发射结束时调用；没有等待者时只多一次 seq_cst 栅栏和一次读取
+    // 等待者的 seq_cst 登记与这里的栅栏处于同一全序：登记排在栅栏之前的等待者
+    // 一定被本次发射看到并唤醒，排在之后的等待者等待下一次发射，不会两头落空
+    template <typename... Ts>
+    void notify_waiters(Ts &... args)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(waiting_.load(std::memory_order_relaxed) == 0)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lk(wait_mutex_);
+            emission_waiter *w = waiters_;
+            waiters_           = nullptr;
+            waiting_.store(0, std::memory_order_relaxed);
+            while(w)
+            {
+                emission_waiter *next = w->next;
+                if(w->out)
+                    *w->out = args_tuple(args...);
+                w->fired.store(true, std::memory_order_release);
+                w = next;
+            }
+        }
+        emitted_.notify_all();
+    }
+
+    void disconnect_slot(const slot_ptr &s)
+    {
+        if(!s)
+            return;
+        std::lock_guard<signal_mutex> lk(mutex_);
+        s->mark_disconnected();
+        dirty_ = true;
+        XSWL_SIGNALS_PROBE2(disconnect, this, s.get());
+    }
+
+    memory_usage_t memory_usage()
+    {
+        memory_usage_t usage = {sizeof(*this) + shared_block_overhead, 0, 0, 0, 0, 0, 0};
+        std::lock_guard<signal_mutex> lk(mutex_);
+        for(const auto &s : slots_)
+        {
+            if(!s)
+                continue;
+            ++usage.slot_count;
+            usage.slots += sizeof(*s) + shared_block_overhead;
+            usage.captures += s->capture_bytes;
+            if(s->dispatcher)
+                usage.dispatchers += s->dispatcher->memory_usage();
+        }
+        for(const auto &t : tags_)
+        {
+            if(t)
+                usage.tags += sizeof(*t) + shared_block_overhead + string_heap_bytes(t->name);
+        }
+        usage.containers = slots_.capacity() * sizeof(slot_ptr) +
+                           tags_.capacity() * sizeof(std::shared_ptr<connection_tag>);
+        if(snapshot_)
+        {
+            usage.containers += sizeof(*snapshot_) + shared_block_overhead +
+                                snapshot_->capacity() * sizeof(slot_ptr);
+        }
+        {
+            std::lock_guard<std::mutex> dk(defer_mutex_);
+            usage.containers += deferrals_.capacity() * sizeof(deferral_state);
+            for(const auto &state : deferrals_)
+                usage.containers += state.items.capacity() * sizeof(args_tuple);
+        }
+        return usage;
+    }
+
+    void cleanup_slots_locked()
+    {
+        auto it = std::remove_if(
+            slots_.begin(), slots_.end(),
+            [](const slot_ptr &s) {
+                return !s || s->pending_removal.load(std::memory_order_acquire);
+            });
+        XSWL_SIGNALS_PROBE2(cleanup, this, static_cast<std::size_t>(slots_.end() - it));
+        slots_.erase(it, slots_.end());
+    }
+
+    // 按优先级遍历当前可调用的槽，invoke(sp) 返回 false 或槽调用了
+    // stop_propagation() 时停止剩余槽（短路）
+    template <typename Invoke>
+    void for_each_callable(Invoke &invoke)
+    {
+        XSWL_SIGNALS_NO_ALLOC_SCOPE(steady);
+        if(registered_.load(std::memory_order_relaxed))
+            emissions_.fetch_add(1, std::memory_order_relaxed);
+        const std::uint32_t sampled = profiler::detail::should_sample();
+        const long long sampled_at  = sampled ? steady_now_ns() : 0;
+        profiler::detail::profile_block *profile = nullptr;
+        std::shared_ptr<const std::vector<slot_ptr>> local_slots;
+        {
+            std::lock_guard<signal_mutex> lk(mutex_);
+            if(sampled)
+            {
+                XSWL_SIGNALS_ALLOW_ALLOC_SCOPE(profile_block);
+                if(!profile_)
+                    profile_ = profiler::detail::make_block(this);
+                profile = profile_.get();
+            }
+
+            if(slots_.empty())
+            {
+                // 没有槽的发射同样成对触发，探针看到的发射次数与实际一致；
+                // 已消耗采样倒计数的发射按扇出 0 记录，估计总数不因空发射偏低
+                profiler::detail::emit_sample sample(profile, name(), sampled_at, sampled);
+                XSWL_SIGNALS_PROBE2(emit_start, this, 0);
+                XSWL_SIGNALS_PROBE2(emit_end, this, 0);
+                return;
+            }
+
+            if(dirty_ || !snapshot_)
+            {
+                XSWL_SIGNALS_ALLOW_ALLOC_SCOPE(rebuild);
+                if(dirty_)
+                {
+                    cleanup_slots_locked();
+                    std::stable_sort(slots_.begin(), slots_.end(),
+                                     [](const slot_ptr &a, const slot_ptr &b) {
+                                         return a->priority > b->priority;
+                                     });
+                    dirty_ = false;
+                }
+                snapshot_ = std::make_shared<const std::vector<slot_ptr>>(slots_);
+            }
+            local_slots = snapshot_; // 持有快照引用，调用槽时不持锁
+        }
+
+        bool need_cleanup = false;
+        emission_scope scope;
+        profiler::detail::emit_sample sample(profile, name(), sampled_at, sampled);
+        XSWL_SIGNALS_PROBE2(emit_start, this, local_slots->size());
+
+        for(const auto &sp : *local_slots)
+        {
+            if(!sp)
+                continue;
+
+            // 检查 tracked 对象是否过期
+            if(sp->tracked_set && sp->tracked.expired())
+            {
+                sp->pending_removal.store(true, std::memory_order_release);
+                need_cleanup = true;
+                continue;
+            }
+
+            // 基础可调用性检查
+            if(!sp->is_callable())
+                continue;
+
+            // 单次槽：使用 CAS 确保只有一个线程执行
+            if(!sp->try_acquire_execution())
+            {
+                continue;
+            }
+
+            // 标记单次槽为待删除
+            if(sp->single_shot)
+            {
+                sp->pending_removal.store(true, std::memory_order_release);
+                need_cleanup = true;
+            }
+
+            bool proceed            = true;
+            const long long slot_at = sample.active() ? steady_now_ns() : 0;
+            try
+            {
+                XSWL_SIGNALS_ALLOW_ALLOC_SCOPE(user);
+                XSWL_SIGNALS_TRACE_SLOT(trace, *this, sp.get());
+                XSWL_SIGNALS_PROBE3(slot_start, this, sp.get(), sp->priority);
+                proceed = invoke(sp);
+            }
+            catch(...)
+            {
+                // 异常吞噬，防止影响其他槽
+            }
+            XSWL_SIGNALS_PROBE3(slot_end, this, sp.get(), sp->priority);
+            if(sample.active())
+                sample.slot(sp.get(), steady_now_ns() - slot_at);
+            if(!proceed || emission_stop_flag())
+                break;
+        }
+
+        XSWL_SIGNALS_PROBE2(emit_end, this, local_slots->size());
+        if(need_cleanup)
+        {
+            std::lock_guard<signal_mutex> lk(mutex_);
+            dirty_ = true;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 延迟发射：deferral_guard_t 存活期间，创建它的线程上的发射只缓存参数，
+    // 该线程最外层守卫结束时统一发射；其他线程的发射照常同步交付
+    // -------------------------------------------------------------------------
+    typedef bool (*tuple_equal_fn)(const args_tuple &, const args_tuple &);
+    typedef void (*tuple_unique_fn)(std::vector<args_tuple> &);
+
+    // equal 非空时发射时丢弃与最近一次缓存的参数相同的发射（每次至多比较一次）；
+    // unique 非空时补发前再按哈希线性去重，丢弃与任一已缓存参数相同的发射
+    void begin_deferral(tuple_equal_fn equal, tuple_unique_fn unique)
+    {
+        std::lock_guard<std::mutex> lk(defer_mutex_);
+        deferral_state *state = find_deferral(std::this_thread::get_id());
+        if(!state)
+        {
+            deferrals_.emplace_back(std::this_thread::get_id());
+            state = &deferrals_.back();
+        }
+        if(equal)
+            state->equal = equal;
+        if(unique)
+            state->unique = unique;
+        ++state->depth;
+        defer_depth_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 返回 true 表示本次发射已被缓存；没有任何守卫时只有一次 relaxed 读取
+    template <typename... Ts>
+    bool try_defer(Ts &... args)
+    {
+        if(defer_depth_.load(std::memory_order_relaxed) == 0)
+            return false;
+
+        std::lock_guard<std::mutex> lk(defer_mutex_);
+        deferral_state *state = find_deferral(std::this_thread::get_id());
+        if(!state)
+            return false; // 守卫属于其他线程，或刚刚结束
+
+        args_tuple item(args...);
+        if(state->equal && !state->items.empty() && state->equal(state->items.back(), item))
+            return true;
+        state->items.push_back(std::move(item));
+        return true;
+    }
+
+    // owner 线程的最外层守卫结束时取出其缓存的参数，按发射顺序返回；全量去重在锁外完成
+    std::vector<args_tuple> end_deferral(std::thread::id owner)
+    {
+        std::vector<args_tuple> items;
+        tuple_unique_fn unique = nullptr;
+        {
+            std::lock_guard<std::mutex> lk(defer_mutex_);
+            deferral_state *state = find_deferral(owner);
+            if(!state)
+                return items;
+            defer_depth_.fetch_sub(1, std::memory_order_relaxed);
+            if(--state->depth != 0)
+                return items;
+            items.swap(state->items);
+            unique = state->unique;
+            deferrals_.erase(deferrals_.begin() + (state - deferrals_.data()));
+        }
+        if(unique)
+            unique(items);
+        return items;
+    }
+
+private:
+    struct deferral_state
+    {
+        explicit deferral_state(std::thread::id t)
+            : thread(t)
+            , depth(0)
+            , equal(nullptr)
+            , unique(nullptr)
+        {
+        }
+
+        std::thread::id thread;
+        std::size_t depth; // 该线程上嵌套的守卫数
+        tuple_equal_fn equal;
+        tuple_unique_fn unique;
+        std::vector<args_tuple> items;
+    };
+
+    // 同时持有守卫的线程通常只有一个，线性查找即可
+    deferral_state *find_deferral(std::thread::id t)
+    {
+        for(auto &state : deferrals_)
+        {
+            if(state.thread == t)
+                return &state;
+        }
+        return nullptr;
+    }
+
+    std::mutex defer_mutex_;
+    std::atomic<std::size_t> defer_depth_{0}; // 所有线程上活动的守卫总数
+    std::vector<deferral_state> deferrals_;
+
+    std::mutex wait_mutex_;
+    emission_waiter *waiters_ = nullptr;
+    std::atomic<std::size_t> waiting_{0};
+    wait_word emitted_;
+};
+
+} // namespace detail
+
+// ============================================================================
+// 连接句柄
+// ============================================================================
+template <typename... Args>
+class connection_t
+{
+public:
+    using impl_type = detail::signal_impl<Args...>;
+    using slot_type = detail::slot<Args...>;
+
+    connection_t() = default;
+
+    connection_t(const std::shared_ptr<impl_type> &impl,
+                 const std::shared_ptr<slot_type> &s)
+        : impl_(impl)
+        , slot_(s)
+    {
+    }
+
+    // 拷贝/移动：复制 weak_ptr 即可
+    connection_t(const connection_t &)            = default;
+    connection_t &operator=(const connection_t &) = default;
+    connection_t(connection_t &&)                 = default;
+    connection_t &operator=(connection_t &&)      = default;
+
+    // 是否仍然连接有效
+    bool is_connected() const
+    {
+        auto s = slot_.lock();
+        return s && !s->pending_removal.load(std::memory_order_acquire);
+    }
+
+    explicit operator bool() const { return is_connected(); }
+
+    // 主动断开
+    void disconnect()
+    {
+        auto impl = impl_.lock();
+        auto s    = slot_.lock();
+        if(impl && s)
+        {
+            impl->disconnect_slot(s);
+        }
+        // 如果 impl 已销毁，则什么也不做（安全）
+    }
+
+    // 阻塞 / 解除阻塞
+    void block(bool b = true)
+    {
+        if(auto s = slot_.lock())
+        {
+            s->blocked.store(b, std::memory_order_release);
+        }
+    }
+
+    void unblock() { block(false); }
+
+    bool is_blocked() const
+    {
+        auto s = slot_.lock();
+        return s && s->blocked.load(std::memory_order_acquire);
+    }
+
+    // 排队连接的邮箱统计；非排队连接或已断开时各项为 0
+    queue_stats_t queue_stats() const
+    {
+        queue_stats_t stats = {0, 0, 0, 0};
+        auto s              = slot_.lock();
+        if(s && s->dispatcher)
+            s->dispatcher->query_queue(stats);
+        return stats;
+    }
+
+    // 设置了耗时预算的连接的开销；未设置预算或已断开时各项为 0
+    slot_cost_t cost() const
+    {
+        slot_cost_t cost = {std::chrono::nanoseconds(0), std::chrono::nanoseconds(0), false, false};
+        auto s           = slot_.lock();
+        if(s && s->dispatcher)
+            s->dispatcher->query_cost(cost);
+        return cost;
+    }
+
+    bool is_slow() const { return cost().slow; }
+
+    // 调用统计；信号未开启统计或已断开时各项为 0
+    slot_stats_t stats() const
+    {
+        slot_stats_t stats = {0, 0, std::chrono::nanoseconds(0), std::chrono::nanoseconds(0)};
+        auto s             = slot_.lock();
+        if(s)
+        {
+            if(detail::slot_stats_counters *st = s->stats.load(std::memory_order_acquire))
+                stats = st->snapshot();
+        }
+        return stats;
+    }
+
+    // 该连接的槽记录、堆上的可调用对象与投递策略占用的内存估算；已断开时为 0
+    std::size_t memory_usage() const
+    {
+        auto s = slot_.lock();
+        return s && !s->pending_removal.load(std::memory_order_acquire) ? s->memory_usage() : 0;
+    }
+
+    // 释放引用（不影响实际连接）
+    void reset()
+    {
+        impl_.reset();
+        slot_.reset();
+    }
+
+private:
+    std::weak_ptr<impl_type> impl_;
+    std::weak_ptr<slot_type> slot_;
+};
+
+namespace detail {
+
+// ============================================================================
+// 信号公共部分：连接管理（void 信号与返回值信号共用）
+// ============================================================================
+template <typename Connection, typename R, typename... Args>
+class basic_signal
+{
+public:
+    using connection_type = Connection;
+    using result_type     = R;
+    using impl_type       = typename Connection::impl_type;
+    using slot_type       = typename Connection::slot_type;
+    using function_type   = typename slot_type::function_type;
+    using slot_ptr        = std::shared_ptr<slot_type>;
+
+    basic_signal()
+        : impl_(std::make_shared<impl_type>())
+    {
+    }
+
+    ~basic_signal()
+    {
+        disconnect_all();
+    }
+
+    basic_signal(basic_signal &&other) noexcept
+        : impl_(std::move(other.impl_))
+    {
+    }
+
+    basic_signal &operator=(basic_signal &&other) noexcept
+    {
+        if(this != &other)
+        {
+            disconnect_all();
+            impl_ = std::move(other.impl_);
+        }
+        return *this;
+    }
+
+    basic_signal(const basic_signal &)            = delete;
+    basic_signal &operator=(const basic_signal &) = delete;
+
+    // -------------------------------------------------------------------------
+    // connect：任意可调用对象（非成员函数指针）|支持参数适配（槽可以接受比信号更少的参数）
+    // options 可直接传入 int 作为优先级，也可指定排队/合并投递
+    // -------------------------------------------------------------------------
+    template <typename Fn>
+    typename std::enable_if<!is_member_function_pointer<typename std::decay<Fn>::type>::value
+                                && callable_arity<Fn, Args...>::is_valid,
+                            connection_type>::type
+    connect(Fn &&func, const connect_options_t &options = connect_options_t())
+    {
+        return connect_with_arity(std::forward<Fn>(func), options, false, std::weak_ptr<void>(),
+                                  std::integral_constant<std::size_t, callable_arity<Fn, Args...>::value>());
+    }
+
+    // 单次连接
+    template <typename Fn>
+    typename std::enable_if<callable_arity<Fn, Args...>::is_valid,
+                            connection_type>::type
+    connect_once(Fn &&func, const connect_options_t &options = connect_options_t())
+    {
+        return connect_with_arity(std::forward<Fn>(func), options, true, std::weak_ptr<void>(),
+                                  std::integral_constant<std::size_t,
+                                                         callable_arity<Fn, Args...>::value>());
+    }
+
+    // ---------------------------------------------------------------------
+    // connect：成员函数 + shared_ptr（支持参数适配 + 自动跟踪对象生命周期）
+    // ---------------------------------------------------------------------
+    template <typename Obj, typename MemFn>
+    typename std::enable_if<is_member_function_pointer<typename std::decay<MemFn>::type>::value,
+                            connection_type>::type
+    connect(const std::shared_ptr<Obj> &obj, MemFn memfn,
+            const connect_options_t &options = connect_options_t())
+    {
+        if(!obj)
+            return connection_type();
+
+        return connect_member_with_arity(
+            obj, memfn, options, false,
+            std::integral_constant<
+                std::size_t,
+                member_function_arity<MemFn>::value>());
+    }
+
+    // ---------------------------------------------------------------------
+    // connect：成员函数 + 裸指针（支持参数适配 + 不跟踪生命周期）
+    // ---------------------------------------------------------------------
+    template <typename Obj, typename MemFn>
+    typename std::enable_if<is_member_function_pointer<typename std::decay<MemFn>::type>::value,
+                            connection_type>::type
+    connect(Obj *obj, MemFn memfn, const connect_options_t &options = connect_options_t())
+    {
+        if(!obj)
+            return connection_type();
+
+        return connect_raw_member_with_arity(
+            obj, memfn, options, false,
+            std::integral_constant<
+                std::size_t,
+                member_function_arity<MemFn>::value>());
+    }
+
+    // -------------------------------------------------------------------------
+    // 带标签的连接（支持参数适配）
+    // -------------------------------------------------------------------------
+    template <typename Fn>
+    typename std::enable_if<callable_arity<Fn, Args...>::is_valid,
+                            connection_type>::type
+    connect(const std::string &tag, Fn &&func,
+            const connect_options_t &options = connect_options_t())
+    {
+        if(!impl_)
+            return connection_type();
+
+        std::shared_ptr<connection_tag> tag_ptr = get_or_create_tag(tag);
+        return connect_with_arity(
+            std::forward<Fn>(func), options, false, std::weak_ptr<void>(tag_ptr),
+            std::integral_constant<std::size_t,
+                                   callable_arity<Fn, Args...>::value>(),
+            true);
+    }
+
+    // -------------------------------------------------------------------------
+    // 通过标签断开
+    // -------------------------------------------------------------------------
+    bool disconnect(const std::string &tag)
+    {
+        if(!impl_)
+            return false;
+
+        std::lock_guard<signal_mutex> lk(impl_->mutex_);
+
+        auto it = std::find_if(
+            impl_->tags_.begin(), impl_->tags_.end(),
+            [&tag](const std::shared_ptr<connection_tag> &t) {
+                return t && t->name == tag;
+            });
+
+        if(it == impl_->tags_.end())
+            return false;
+
+        auto tag_ptr = *it;
+        impl_->tags_.erase(it);
+
+        for(auto &s : impl_->slots_)
+        {
+            if(s && s->tracked.lock() == tag_ptr)
+            {
+                s->mark_disconnected();
+            }
+        }
+        impl_->dirty_ = true;
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // 管理接口
+    // -------------------------------------------------------------------------
+    void disconnect_all()
+    {
+        if(!impl_)
+            return;
+
+        std::lock_guard<signal_mutex> lk(impl_->mutex_);
+        for(auto &s : impl_->slots_)
+        {
+            if(s)
+                s->mark_disconnected();
+        }
+        XSWL_SIGNALS_PROBE2(cleanup, impl_.get(), impl_->slots_.size());
+        impl_->slots_.clear();
+        impl_->tags_.clear();
+        impl_->snapshot_.reset();
+        impl_->dirty_ = false;
+    }
+
+    // 槽调用统计：开启后为现有及之后的连接记录调用次数、耗时与异常；
+    // 关闭时停止记录，已有数据保留
+    void enable_stats(bool enable = true)
+    {
+        if(!impl_)
+            return;
+        std::lock_guard<signal_mutex> lk(impl_->mutex_);
+        impl_->stats_enabled_ = enable;
+        for(auto &s : impl_->slots_)
+        {
+            if(s)
+                impl_->enable_slot_stats_locked(s);
+        }
+    }
+
+    bool stats_enabled() const
+    {
+        if(!impl_)
+            return false;
+        std::lock_guard<signal_mutex> lk(impl_->mutex_);
+        return impl_->stats_enabled_;
+    }
+
+    // 各连接的统计，按累计耗时从高到低排列；未收集过统计的连接不列出
+    std::vector<std::pair<connection_type, slot_stats_t>> slot_stats() const
+    {
+        std::vector<std::pair<connection_type, slot_stats_t>> out;
+        if(!impl_)
+            return out;
+        {
+            std::lock_guard<signal_mutex> lk(impl_->mutex_);
+            for(const auto &s : impl_->slots_)
+            {
+                if(!s || s->pending_removal.load(std::memory_order_acquire))
+                    continue;
+                if(detail::slot_stats_counters *st = s->stats.load(std::memory_order_acquire))
+                    out.emplace_back(connection_type(impl_, s), st->snapshot());
+            }
+        }
+        std::stable_sort(out.begin(), out.end(),
+                         [](const std::pair<connection_type, slot_stats_t> &a,
+                            const std::pair<connection_type, slot_stats_t> &b) {
+                             return a.second.total > b.second.total;
+                         });
+        return out;
+    }
+
+#if defined(XSWL_SIGNALS_LOCK_STATS)
+    // 内部互斥量的竞争统计：覆盖发射取快照、连接、断开、标签操作与 slot_count() 等全部加锁路径
+    lock_stats_t lock_stats() const
+    {
+        lock_stats_t stats = {0, 0, std::chrono::nanoseconds(0), std::chrono::nanoseconds(0)};
+        return impl_ ? impl_->mutex_.stats() : stats;
+    }
+
+    void reset_lock_stats()
+    {
+        if(impl_)
+            impl_->mutex_.reset();
+    }
+#endif
+
+    // 以 name 登记到全局信号登记表（同时设置信号名称，见 set_name()），信号销毁时自动注销；
+    // 登记后每次发射多一次 relaxed 计数
+    void register_as(const std::string &name)
+    {
+        if(!impl_)
+            return;
+        set_name(name);
+        signal_registry::detail::add(impl_.get(), impl_->registered_,
+                                     std::weak_ptr<void>(impl_), &impl_type::query_info);
+    }
+
+    void unregister()
+    {
+        if(impl_)
+            signal_registry::detail::remove(impl_.get(), impl_->registered_);
+    }
+
+    bool is_registered() const
+    {
+        return impl_ && impl_->registered_.load(std::memory_order_acquire);
+    }
+
+    // 信号名称：用于追踪等诊断输出；名称在进程内驻留，不随信号销毁
+    // 每个不同的名称保留到进程结束，名称应取自有限的集合（如按类型或用途命名），
+    // 不要为每个实例生成不同的名称
+    void set_name(const std::string &name)
+    {
+        if(impl_)
+            impl_->name_.store(detail::intern_name(name), std::memory_order_relaxed);
+    }
+
+    std::string name() const
+    {
+        const char *n = impl_ ? impl_->name() : nullptr;
+        return n ? std::string(n) : std::string();
+    }
+
+    // 内存占用估算：各项按对象大小、容器容量与 make_shared 控制块计算，
+    // 可调用对象自身再持有的堆内存（如捕获的 std::string 内容）不计入
+    memory_usage_t memory_usage() const
+    {
+        if(!impl_)
+            return memory_usage_t{0, 0, 0, 0, 0, 0, 0};
+        return impl_->memory_usage();
+    }
+
+    // 槽数量（过滤掉已标记删除的）
+    std::size_t slot_count() const
+    {
+        if(!impl_)
+            return 0;
+
+        std::lock_guard<signal_mutex> lk(impl_->mutex_);
+        std::size_t count = 0;
+        for(auto &s : impl_->slots_)
+        {
+            if(s && !s->pending_removal.load(std::memory_order_acquire))
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    bool empty() const
+    {
+        return slot_count() == 0;
+    }
+
+    bool valid() const
+    {
+        return impl_ != nullptr;
+    }
+
+    // -------------------------------------------------------------------------
+    // 等待下一次发射：该次发射的槽全部调用完毕后返回 true，超时返回 false
+    // 等待者不分配内存；没有等待者时发射方只多一次 relaxed 读取
+    // -------------------------------------------------------------------------
+    template <typename Rep, typename Period>
+    bool wait(const std::chrono::duration<Rep, Period> &timeout) const
+    {
+        std::shared_ptr<impl_type> impl = impl_;
+        return impl && impl->wait_emission(nullptr, wait_word::deadline_after(timeout));
+    }
+
+    // 同 wait，并把该次发射的参数写入 args_out
+    template <typename Rep, typename Period>
+    bool wait_for(typename impl_type::args_tuple &args_out,
+                  const std::chrono::duration<Rep, Period> &timeout) const
+    {
+        std::shared_ptr<impl_type> impl = impl_;
+        return impl && impl->wait_emission(&args_out, wait_word::deadline_after(timeout));
+    }
+
+protected:
+    std::shared_ptr<impl_type> impl_;
+
+private:
+    // -------------------------------------------------------------------------
+    // 参数适配分发（完整参数，无需适配）
+    // -------------------------------------------------------------------------
+    template <typename Fn>
+    connection_type connect_with_arity(Fn &&func,
+                                       const connect_options_t &options,
+                                       bool single_shot,
+                                       std::weak_ptr<void> tracked,
+                                       std::integral_constant<std::size_t, sizeof...(Args)>,
+                                       bool has_tracked = false)
+    {
+        return connect_impl(std::forward<Fn>(func), options,
+                            single_shot, std::move(tracked), has_tracked);
+    }
+
+    // 参数适配分发（需要适配）
+    template <typename Fn, std::size_t N>
+    connection_type connect_with_arity(Fn &&func,
+                                       const connect_options_t &options,
+                                       bool single_shot,
+                                       std::weak_ptr<void> tracked,
+                                       std::integral_constant<std::size_t, N>,
+                                       bool has_tracked = false)
+    {
+        auto adapter = make_arg_adapter<R, N>(std::forward<Fn>(func));
+        return connect_impl(std::move(adapter), options, single_shot,
+                            std::move(tracked), has_tracked);
+    }
+
+    // -------------------------------------------------------------------------
+    // 成员函数连接（shared_ptr）
+    // -------------------------------------------------------------------------
+    template <typename Obj, typename MemFn>
+    connection_type connect_member_with_arity(
+        const std::shared_ptr<Obj> &obj,
+        MemFn memfn,
+        const connect_options_t &options,
+        bool single_shot,
+        std::integral_constant<std::size_t, sizeof...(Args)>)
+    {
+        std::weak_ptr<Obj> weak_obj = obj;
+        auto wrapper                = [weak_obj, memfn](Args... args) -> R {
+            std::shared_ptr<Obj> sp = weak_obj.lock();
+            if(sp)
+            {
+                return static_cast<R>((sp.get()->*memfn)(args...));
+            }
+            return R();
+        };
+        return connect_impl(std::move(wrapper), options, single_shot,
+                            std::weak_ptr<void>(obj), true);
+    }
+
+    template <typename Obj, typename MemFn, std::size_t N>
+    connection_type connect_member_with_arity(
+        const std::shared_ptr<Obj> &obj,
+        MemFn memfn,
+        const connect_options_t &options,
+        bool single_shot,
+        std::integral_constant<std::size_t, N>)
+    {
+        std::weak_ptr<Obj> weak_obj = obj;
+        auto wrapper                = [weak_obj, memfn](Args... args) -> R {
+            std::shared_ptr<Obj> sp = weak_obj.lock();
+            if(sp)
+            {
+                return call_member_with_n_args<N>(sp.get(), memfn, args...);
+            }
+            return R();
+        };
+        return connect_impl(std::move(wrapper), options, single_shot,
+                            std::weak_ptr<void>(obj), true);
+    }
+
+    // -------------------------------------------------------------------------
+    // 成员函数连接（裸指针）
+    // -------------------------------------------------------------------------
+    template <typename Obj, typename MemFn>
+    connection_type connect_raw_member_with_arity(
+        Obj *obj,
+        MemFn memfn,
+        const connect_options_t &options,
+        bool single_shot,
+        std::integral_constant<std::size_t, sizeof...(Args)>)
+    {
+        auto wrapper = [obj, memfn](Args... args) -> R {
+            return static_cast<R>((obj->*memfn)(args...));
+        };
+        return connect_impl(std::move(wrapper), options, single_shot,
+                            std::weak_ptr<void>());
+    }
+
+    template <typename Obj, typename MemFn, std::size_t N>
+    connection_type connect_raw_member_with_arity(
+        Obj *obj,
+        MemFn memfn,
+        const connect_options_t &options,
+        bool single_shot,
+        std::integral_constant<std::size_t, N>)
+    {
+        auto wrapper = [obj, memfn](Args... args) -> R {
+            return call_member_with_n_args<N>(obj, memfn, args...);
+        };
+        return connect_impl(std::move(wrapper), options, single_shot,
+                            std::weak_ptr<void>());
+    }
+
+    // -------------------------------------------------------------------------
+    // 辅助函数：调用成员函数（只传递前 N 个参数）
+    // -------------------------------------------------------------------------
+    template <std::size_t N, typename Obj, typename MemFn, typename... CallArgs>
+    static typename std::enable_if<N == 0, R>::type
+    call_member_with_n_args(Obj *obj, MemFn memfn, CallArgs &&...)
+    {
+        return static_cast<R>((obj->*memfn)());
+    }
+
+    template <std::size_t N, typename Obj, typename MemFn, typename A1,
+              typename... Rest>
+    static typename std::enable_if<N == 1, R>::type
+    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, Rest &&...)
+    {
+        return static_cast<R>((obj->*memfn)(std::forward<A1>(a1)));
+    }
+
+    template <std::size_t N, typename Obj, typename MemFn, typename A1, typename A2,
+              typename... Rest>
+    static typename std::enable_if<N == 2, R>::type
+    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, A2 &&a2, Rest &&...)
+    {
+        return static_cast<R>((obj->*memfn)(std::forward<A1>(a1), std::forward<A2>(a2)));
+    }
+
+    template <std::size_t N, typename Obj, typename MemFn, typename A1, typename A2,
+              typename A3, typename... Rest>
+    static typename std::enable_if<N == 3, R>::type
+    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, A2 &&a2, A3 &&a3,
+                            Rest &&...)
+    {
+        return static_cast<R>((obj->*memfn)(std::forward<A1>(a1), std::forward<A2>(a2),
+                                            std::forward<A3>(a3)));
+    }
+
+    template <std::size_t N, typename Obj, typename MemFn, typename A1, typename A2,
+              typename A3, typename A4, typename... Rest>
+    static typename std::enable_if<N == 4, R>::type
+    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, A2 &&a2, A3 &&a3,
+                            A4 &&a4, Rest &&...)
+    {
+        return static_cast<R>((obj->*memfn)(std::forward<A1>(a1), std::forward<A2>(a2),
+                                            std::forward<A3>(a3), std::forward<A4>(a4)));
+    }
+
+    template <std::size_t N, typename Obj, typename MemFn, typename A1, typename A2,
+              typename A3, typename A4, typename A5, typename... Rest>
+    static typename std::enable_if<N == 5, R>::type
+    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, A2 &&a2, A3 &&a3,
+                            A4 &&a4, A5 &&a5, Rest &&...)
+    {
+        return static_cast<R>((obj->*memfn)(std::forward<A1>(a1), std::forward<A2>(a2),
+                                            std::forward<A3>(a3), std::forward<A4>(a4),
+                                            std::forward<A5>(a5)));
+    }
+
+    template <std::size_t N, typename Obj, typename MemFn, typename A1, typename A2,
+              typename A3, typename A4, typename A5, typename A6, typename... Rest>
+    static typename std::enable_if<N == 6, R>::type
+    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, A2 &&a2, A3 &&a3,
+                            A4 &&a4, A5 &&a5, A6 &&a6, Rest &&...)
+    {
+        return static_cast<R>((obj->*memfn)(std::forward<A1>(a1), std::forward<A2>(a2),
+                                            std::forward<A3>(a3), std::forward<A4>(a4),
+                                            std::forward<A5>(a5), std::forward<A6>(a6)));
+    }
+
+    // -------------------------------------------------------------------------
+    // 实际连接实现
+    // -------------------------------------------------------------------------
+    template <typename F>
+    connection_type connect_impl(F &&f,
+                                 const connect_options_t &options,
+                                 bool ss,
+                                 std::weak_ptr<void> tracked,
+                                 bool has_tracked = false)
+    {
+        if(!impl_)
+            return connection_type();
+
+        auto d = make_slot_dispatcher(options, static_cast<slot_type *>(nullptr));
+        if(!d && !is_synchronous(options))
+            throw std::invalid_argument(
+                "xswl::signal_t<R(Args...)>: value-returning signals only support synchronous "
+                "connections (no queued, rate-limited, thread-affine or budgeted options)");
+        // 预算测量的是发射线程上的同步调用，排队或线程亲和的槽不在发射线程上执行
+        if(options.budget().count() > 0 && (options.is_queued() || options.is_thread_affine()))
+            throw std::invalid_argument(
+                "xswl::signal_t: budget() cannot be combined with queued(), coalesced() or "
+                "thread_affine()");
+
+        auto s = std::make_shared<slot_type>(function_type(std::forward<F>(f)), options.priority(),
+                                             ss, std::move(tracked), has_tracked);
+        s->capture_bytes = static_cast<std::uint32_t>(
+            detail::function_capture_bytes<typename std::decay<F>::type, function_type>::value);
+        s->dispatcher = std::move(d);
+        {
+            std::lock_guard<signal_mutex> lk(impl_->mutex_);
+            impl_->enable_slot_stats_locked(s);
+            impl_->slots_.push_back(s);
+            impl_->dirty_ = true;
+        }
+        XSWL_SIGNALS_PROBE3(connect, impl_.get(), s.get(), s->priority);
+        return connection_type(impl_, s);
+    }
+
+    std::shared_ptr<connection_tag> get_or_create_tag(const std::string &name)
+    {
+        std::lock_guard<signal_mutex> lk(impl_->mutex_);
+        for(auto &t : impl_->tags_)
+        {
+            if(t && t->name == name)
+                return t;
+        }
+        auto t = std::make_shared<connection_tag>(name);
+        impl_->tags_.push_back(t);
+        return t;
+    }
+};
+
+} // namespace detail
+
+// ============================================================================
+// 停止传播：在槽内调用后，本次发射不再调用剩余的（低优先级）槽
+// 只影响当前线程上最内层的发射；在发射之外调用没有效果
+// ============================================================================
+inline void stop_propagation()
+{
+    detail::emission_stop_flag() = true;
+}
+
+// ============================================================================
+// 合并器：汇总返回值信号各个槽的结果，结果保存在合并器自身（调用者栈上）
+// 约定：operator()(T) 接收一个槽的返回值，返回 false 时跳过剩余槽（短路）
+//       result() 返回最终结果
+// ============================================================================
+
+// 最后一个槽的返回值（默认合并器）
+template <typename T>
+class last_value_t
+{
+public:
+    using result_type = T;
+
+    last_value_t()
+        : value_() {}
+
+    bool operator()(T v)
+    {
+        value_ = std::move(v);
+        return true;
+    }
+
+    T result() const { return value_; }
+
+private:
+    T value_;
+};
+
+template <>
+class last_value_t<void>
+{
+public:
+    using result_type = void;
+
+    bool operator()() { return true; }
+    void result() const {}
+};
+
+// 求和
+template <typename T>
+class sum_t
+{
+public:
+    using result_type = T;
+
+    explicit sum_t(T init = T())
+        : total_(std::move(init)) {}
+
+    bool operator()(const T &v)
+    {
+        total_ += v;
+        return true;
+    }
+
+    T result() const { return total_; }
+
+private:
+    T total_;
+};
+
+// 最小值；没有任何槽被调用时 result() 返回 T()
+template <typename T>
+class min_t
+{
+public:
+    using result_type = T;
+
+    min_t()
+        : value_()
+        , has_value_(false) {}
+
+    bool operator()(T v)
+    {
+        if(!has_value_ || v < value_)
+            value_ = std::move(v);
+        has_value_ = true;
+        return true;
+    }
+
+    bool has_value() const { return has_value_; }
+    T result() const { return value_; }
+
+private:
+    T value_;
+    bool has_value_;
+};
 
-        auto tag_ptr = *it;
-        impl_->tags_.erase(it);
+// 最大值；没有任何槽被调用时 result() 返回 T()
+template <typename T>
+class max_t
+{
+public:
+    using result_type = T;
 
-        for(auto &s : impl_->slots_)
-        {
-            if(s && s->tracked.lock() == tag_ptr)
-            {
-                s->pending_removal.store(true, std::memory_order_release);
-            }
-        }
-        impl_->dirty_ = true;
+    max_t()
+        : value_()
+        , has_value_(false) {}
+
+    bool operator()(T v)
+    {
+        if(!has_value_ || value_ < v)
+            value_ = std::move(v);
+        has_value_ = true;
         return true;
     }
 
-    // -------------------------------------------------------------------------
-    // 发射信号
-    // -------------------------------------------------------------------------
-    void operator()(Args... args) const
+    bool has_value() const { return has_value_; }
+    T result() const { return value_; }
+
+private:
+    T value_;
+    bool has_value_;
+};
+
+// 收集到调用者提供的缓冲区；缓冲区写满后跳过剩余槽，result() 返回写入数量
+template <typename T>
+class collect_t
+{
+public:
+    using result_type = std::size_t;
+
+    collect_t(T *buffer, std::size_t capacity)
+        : buffer_(buffer)
+        , capacity_(capacity)
+        , count_(0) {}
+
+    template <std::size_t N>
+    explicit collect_t(T (&buffer)[N])
+        : buffer_(buffer)
+        , capacity_(N)
+        , count_(0) {}
+
+    bool operator()(T v)
     {
-        if(!impl_)
-            return;
+        if(count_ >= capacity_)
+            return false;
+        buffer_[count_++] = std::move(v);
+        return count_ < capacity_;
+    }
 
-        std::vector<slot_ptr> local_slots;
-        {
-            std::lock_guard<std::mutex> lk(impl_->mutex_);
-            if(impl_->slots_.empty())
-                return;
+    std::size_t result() const { return count_; }
 
-            if(impl_->dirty_)
-            {
-                impl_->cleanup_slots_locked();
-                std::stable_sort(impl_->slots_.begin(), impl_->slots_.end(),
-                                 [](const slot_ptr &a, const slot_ptr &b) {
-                                     return a->priority > b->priority;
-                                 });
-                impl_->dirty_ = false;
-            }
-            local_slots.reserve(impl_->slots_.size());
-            local_slots = impl_->slots_; // 拷贝一份，避免长时间持锁
-        }
+private:
+    T *buffer_;
+    std::size_t capacity_;
+    std::size_t count_;
+};
 
-        bool need_cleanup = false;
+// 第一个非空（转换为 true）的结果，找到后跳过剩余槽；没有时返回 T()
+template <typename T>
+class first_non_null_t
+{
+public:
+    using result_type = T;
 
-        for(const auto &sp : local_slots)
-        {
-            if(!sp)
-                continue;
+    first_non_null_t()
+        : value_() {}
 
-            // 检查 tracked 对象是否过期
-            if(sp->tracked_set && sp->tracked.expired())
-            {
-                sp->pending_removal.store(true, std::memory_order_release);
-                need_cleanup = true;
-                continue;
-            }
+    bool operator()(T v)
+    {
+        if(!v)
+            return true;
+        value_ = std::move(v);
+        return false;
+    }
 
-            // 基础可调用性检查
-            if(!sp->is_callable())
-                continue;
+    T result() const { return value_; }
 
-            // 单次槽：使用 CAS 确保只有一个线程执行
-            if(!sp->try_acquire_execution())
-            {
-                continue;
-            }
+private:
+    T value_;
+};
 
-            // 标记单次槽为待删除
-            if(sp->single_shot)
-            {
-                sp->pending_removal.store(true, std::memory_order_release);
-                need_cleanup = true;
-            }
+namespace detail {
 
-            try
-            {
-                sp->func(args...);
-            }
-            catch(...)
-            {
-                // 异常吞噬，防止影响其他槽
-            }
+// 调用槽并把结果交给合并器；void 信号的合并器以无参形式调用
+// 槽统计只计入槽函数本身的耗时，不包括合并器
+template <typename R>
+struct combine_result
+{
+    template <typename Combiner, typename Fn, typename... Ts>
+    static bool call(Combiner &combiner, Fn &fn, const std::atomic<slot_stats_counters *> &stats,
+                     Ts &... args)
+    {
+        return combiner(timed(fn, stats, args...));
+    }
+
+private:
+    // 计时器在返回前析构并记录，合并器在此之后才运行
+    template <typename Fn, typename... Ts>
+    static R timed(Fn &fn, const std::atomic<slot_stats_counters *> &stats, Ts &... args)
+    {
+        slot_call_timer timer(stats);
+        R value = fn(args...);
+        timer.done();
+        return value;
+    }
+};
+
+template <>
+struct combine_result<void>
+{
+    template <typename Combiner, typename Fn, typename... Ts>
+    static bool call(Combiner &combiner, Fn &fn, const std::atomic<slot_stats_counters *> &stats,
+                     Ts &... args)
+    {
+        {
+            slot_call_timer timer(stats);
+            fn(args...);
+            timer.done();
         }
+        return combiner();
+    }
+};
 
-        if(need_cleanup)
+// 把发射结果写入 promise；void 信号只标记完成
+template <typename R>
+struct promise_fulfiller
+{
+    template <typename Fn, typename Tuple>
+    static void run(std::promise<R> &p, Fn &fn, Tuple &args)
+    {
+        p.set_value(apply_tuple(fn, args));
+    }
+};
+
+template <>
+struct promise_fulfiller<void>
+{
+    template <typename Fn, typename Tuple>
+    static void run(std::promise<void> &p, Fn &fn, Tuple &args)
+    {
+        apply_tuple(fn, args);
+        p.set_value();
+    }
+};
+
+// 整次发射打包为一个执行器任务：参数按值保存，信号状态由 shared_ptr 保活
+template <typename R, typename Fn, typename Tuple>
+struct async_emission
+{
+    std::shared_ptr<std::promise<R>> done;
+    Fn fn;
+    Tuple args;
+
+    void operator()()
+    {
+        try
         {
-            std::lock_guard<std::mutex> lk(impl_->mutex_);
-            impl_->dirty_ = true;
+            promise_fulfiller<R>::run(*done, fn, args);
         }
+        catch(...)
+        {
+            done->set_exception(std::current_exception());
+        }
+    }
+};
+
+template <typename R, typename Fn, typename Tuple>
+std::future<R> post_emission(std::shared_ptr<executor_t> ex, Fn fn, Tuple args)
+{
+    if(!ex)
+        ex = default_executor();
+
+    auto done = std::make_shared<std::promise<R>>();
+    std::future<R> result = done->get_future();
+    async_emission<R, Fn, Tuple> task = {done, std::move(fn), std::move(args)};
+    ex->post(std::move(task));
+    return result;
+}
+
+} // namespace detail
+
+// ============================================================================
+// 信号类
+// ============================================================================
+template <typename... Args>
+class signal_t : public detail::basic_signal<connection_t<Args...>, void, Args...>
+{
+    using base_type = detail::basic_signal<connection_t<Args...>, void, Args...>;
+
+public:
+    using impl_type  = typename base_type::impl_type;
+    using slot_ptr   = typename base_type::slot_ptr;
+    using args_tuple = std::tuple<typename std::decay<Args>::type...>;
+
+    // -------------------------------------------------------------------------
+    // 发射信号
+    // -------------------------------------------------------------------------
+    void operator()(Args... args) const
+    {
+        if(!this->impl_)
+            return;
+
+        emit_to(*this->impl_, args...);
     }
 
     void emit_signal(Args... args) const
@@ -686,261 +4934,254 @@ public:
     }
 
     // -------------------------------------------------------------------------
-    // 管理接口
+    // 异步发射：整次扇出作为一个任务在执行器上运行，槽仍按优先级顺序调用
+    // 发射线程只付出一次入队；返回的 future 在所有槽调用完毕后就绪
     // -------------------------------------------------------------------------
-    void disconnect_all()
+    std::future<void> emit_async(Args... args) const
     {
-        if(!impl_)
-            return;
+        return emit_async_on(default_executor(), args...);
+    }
 
-        std::lock_guard<std::mutex> lk(impl_->mutex_);
-        for(auto &s : impl_->slots_)
-        {
-            if(s)
-                s->pending_removal.store(true, std::memory_order_release);
-        }
-        impl_->slots_.clear();
-        impl_->tags_.clear();
-        impl_->dirty_ = false;
+    std::future<void> emit_async_on(const std::shared_ptr<executor_t> &ex, Args... args) const
+    {
+        emitter fn = {this->impl_};
+        return detail::post_emission<void>(ex, fn, args_tuple(args...));
     }
 
-    // 槽数量（过滤掉已标记删除的）
-    std::size_t slot_count() const
+private:
+    struct emitter
     {
-        if(!impl_)
-            return 0;
+        std::shared_ptr<impl_type> impl;
 
-        std::lock_guard<std::mutex> lk(impl_->mutex_);
-        std::size_t count = 0;
-        for(auto &s : impl_->slots_)
+        void operator()(Args &... args) const
         {
-            if(s && !s->pending_removal.load(std::memory_order_acquire))
-            {
-                ++count;
-            }
+            if(impl)
+                emit_to(*impl, args...);
         }
-        return count;
-    }
+    };
 
-    bool empty() const
+    friend class deferral_guard_t;
+    friend class async_signal_queue_t<Args...>;
+
+    // owner 线程延迟期间缓存的发射按原顺序补发
+    static void flush_deferred(impl_type &impl, std::thread::id owner)
     {
-        return slot_count() == 0;
+        std::vector<args_tuple> items = impl.end_deferral(owner);
+        for(auto &item : items)
+        {
+            auto call = [&impl](Args &... args) { emit_to(impl, args...); };
+            detail::apply_tuple(call, item);
+        }
     }
 
-    bool valid() const
+    static void emit_to(impl_type &impl, Args &... args)
     {
-        return impl_ != nullptr;
+        if(impl.try_defer(args...))
+            return;
+
+        XSWL_SIGNALS_TRACE_EMIT(trace, impl);
+        auto invoke = [&](const slot_ptr &sp) -> bool {
+            if(sp->dispatcher)
+                sp->dispatcher->dispatch(sp, args...);
+            else
+                sp->call(args...);
+            return true;
+        };
+        impl.for_each_callable(invoke);
+        impl.notify_waiters(args...);
     }
+};
 
-private:
-    std::shared_ptr<impl_type> impl_;
+// ============================================================================
+// 返回值信号：signal_t<R(Args...)>，通过合并器汇总各槽的返回值
+// ============================================================================
+template <typename R, typename... Args>
+class signal_t<R(Args...)>
+    : public detail::basic_signal<connection_t<R(Args...)>, R, Args...>
+{
+    using base_type = detail::basic_signal<connection_t<R(Args...)>, R, Args...>;
 
-    friend class connection_t<Args...>;
+public:
+    using impl_type  = typename base_type::impl_type;
+    using slot_ptr   = typename base_type::slot_ptr;
+    using args_tuple = std::tuple<typename std::decay<Args>::type...>;
 
-    // -------------------------------------------------------------------------
-    // 参数适配分发（完整参数，无需适配）
-    // -------------------------------------------------------------------------
-    template <typename Fn>
-    connection_t<Args...> connect_with_arity(Fn &&func,
-                                             int priority,
-                                             bool single_shot,
-                                             std::weak_ptr<void> tracked,
-                                             std::integral_constant<std::size_t, sizeof...(Args)>,
-                                             bool has_tracked = false)
-    {
-        return connect_impl(function_type(std::forward<Fn>(func)), priority,
-                            single_shot, std::move(tracked), has_tracked);
+    // 使用默认合并器发射，返回最后一个被调用槽的结果（没有槽时为 R()）
+    R operator()(Args... args) const
+    {
+        last_value_t<R> combiner;
+        return combine(combiner, args...);
     }
 
-    // 参数适配分发（需要适配）
-    template <typename Fn, std::size_t N>
-    connection_t<Args...> connect_with_arity(Fn &&func,
-                                             int priority,
-                                             bool single_shot,
-                                             std::weak_ptr<void> tracked,
-                                             std::integral_constant<std::size_t, N>,
-                                             bool has_tracked = false)
-    {
-        auto adapter = detail::make_arg_adapter<N>(std::forward<Fn>(func));
-        return connect_impl(function_type(adapter), priority, single_shot,
-                            std::move(tracked), has_tracked);
+    R emit_signal(Args... args) const
+    {
+        return (*this)(args...);
     }
 
-    // -------------------------------------------------------------------------
-    // 成员函数连接（shared_ptr）
-    // -------------------------------------------------------------------------
-    template <typename Obj, typename MemFn>
-    connection_t<Args...> connect_member_with_arity(
-        const std::shared_ptr<Obj> &obj,
-        MemFn memfn,
-        int priority,
-        bool single_shot,
-        std::integral_constant<std::size_t, sizeof...(Args)>)
+    // 使用指定合并器发射；合并器可按引用传入以便发射后继续读取其状态
+    template <typename Combiner>
+    typename std::decay<Combiner>::type::result_type combine(Combiner &&combiner,
+                                                             Args... args) const
     {
-        std::weak_ptr<Obj> weak_obj = obj;
-        auto wrapper                = [weak_obj, memfn](Args... args) {
-            std::shared_ptr<Obj> sp = weak_obj.lock();
-            if(sp)
-            {
-                (sp.get()->*memfn)(args...);
-            }
-        };
-        return connect_impl(function_type(wrapper), priority, single_shot,
-                            std::weak_ptr<void>(obj), true);
+        if(this->impl_)
+            combine_to(*this->impl_, combiner, args...);
+        return combiner.result();
     }
 
-    template <typename Obj, typename MemFn, std::size_t N>
-    connection_t<Args...> connect_member_with_arity(
-        const std::shared_ptr<Obj> &obj,
-        MemFn memfn,
-        int priority,
-        bool single_shot,
-        std::integral_constant<std::size_t, N>)
+    // 异步发射：future 的值为默认合并器的结果
+    std::future<R> emit_async(Args... args) const
     {
-        std::weak_ptr<Obj> weak_obj = obj;
-        auto wrapper                = [weak_obj, memfn](Args... args) {
-            std::shared_ptr<Obj> sp = weak_obj.lock();
-            if(sp)
-            {
-                call_member_with_n_args<N>(sp.get(), memfn, args...);
-            }
-        };
-        return connect_impl(function_type(wrapper), priority, single_shot,
-                            std::weak_ptr<void>(obj), true);
+        return emit_async_on(default_executor(), args...);
     }
 
-    // -------------------------------------------------------------------------
-    // 成员函数连接（裸指针）
-    // -------------------------------------------------------------------------
-    template <typename Obj, typename MemFn>
-    connection_t<Args...> connect_raw_member_with_arity(
-        Obj *obj,
-        MemFn memfn,
-        int priority,
-        bool single_shot,
-        std::integral_constant<std::size_t, sizeof...(Args)>)
+    std::future<R> emit_async_on(const std::shared_ptr<executor_t> &ex, Args... args) const
     {
-        auto wrapper = [obj, memfn](Args... args) { (obj->*memfn)(args...); };
-        return connect_impl(function_type(wrapper), priority, single_shot,
-                            std::weak_ptr<void>());
+        emitter fn = {this->impl_};
+        return detail::post_emission<R>(ex, fn, args_tuple(args...));
     }
 
-    template <typename Obj, typename MemFn, std::size_t N>
-    connection_t<Args...> connect_raw_member_with_arity(
-        Obj *obj,
-        MemFn memfn,
-        int priority,
-        bool single_shot,
-        std::integral_constant<std::size_t, N>)
+private:
+    struct emitter
+    {
+        std::shared_ptr<impl_type> impl;
+
+        R operator()(Args &... args) const
+        {
+            last_value_t<R> combiner;
+            if(impl)
+                combine_to(*impl, combiner, args...);
+            return combiner.result();
+        }
+    };
+
+    template <typename Combiner>
+    static void combine_to(impl_type &impl, Combiner &combiner, Args &... args)
+    {
+        XSWL_SIGNALS_TRACE_EMIT(trace, impl);
+        auto invoke = [&](const slot_ptr &sp) -> bool {
+            return detail::combine_result<R>::call(combiner, sp->func, sp->stats, args...);
+        };
+        impl.for_each_callable(invoke);
+        impl.notify_waiters(args...);
+    }
+};
+
+// ============================================================================
+// deferral_guard_t：作用域内缓存所列信号的发射，析构时逐个信号集中补发
+// 只缓存创建守卫的线程上的发射；守卫存活期间其他线程对这些信号的发射照常同步交付，
+// 不会被缓存，也不会改到守卫所在的线程上执行
+// ============================================================================
+struct dedup_t
+{
+};
+
+struct dedup_consecutive_t
+{
+};
+
+// 传给 deferral_guard_t 构造函数，丢弃与任一已缓存的发射参数完全相同的发射
+constexpr dedup_t dedup{};
+
+// 只丢弃与上一次缓存的发射参数完全相同的发射：每次发射只比较一次，被隔开的重复各自补发
+constexpr dedup_consecutive_t dedup_consecutive{};
+
+class deferral_guard_t
+{
+public:
+    template <typename... Args, typename... Rest>
+    explicit deferral_guard_t(signal_t<Args...> &first, Rest &... rest)
+    {
+        defer_all(std::false_type(), false, first, rest...);
+    }
+
+    // 去重要求参数类型支持 operator==；全量去重在补发时按 std::hash 线性完成，
+    // 参数中有不支持 std::hash 的类型时退化为只合并连续的重复发射
+    template <typename... Args, typename... Rest>
+    deferral_guard_t(dedup_t, signal_t<Args...> &first, Rest &... rest)
     {
-        auto wrapper = [obj, memfn](Args... args) {
-            call_member_with_n_args<N>(obj, memfn, args...);
-        };
-        return connect_impl(function_type(wrapper), priority, single_shot,
-                            std::weak_ptr<void>());
+        defer_all(std::true_type(), true, first, rest...);
     }
 
-    // -------------------------------------------------------------------------
-    // 辅助函数：调用成员函数（只传递前 N 个参数）
-    // -------------------------------------------------------------------------
-    template <std::size_t N, typename Obj, typename MemFn, typename... CallArgs>
-    static typename std::enable_if<N == 0>::type
-    call_member_with_n_args(Obj *obj, MemFn memfn, CallArgs &&...)
+    template <typename... Args, typename... Rest>
+    deferral_guard_t(dedup_consecutive_t, signal_t<Args...> &first, Rest &... rest)
     {
-        (obj->*memfn)();
+        defer_all(std::true_type(), false, first, rest...);
     }
 
-    template <std::size_t N, typename Obj, typename MemFn, typename A1,
-              typename... Rest>
-    static typename std::enable_if<N == 1>::type
-    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, Rest &&...)
+    deferral_guard_t(const deferral_guard_t &)            = delete;
+    deferral_guard_t &operator=(const deferral_guard_t &) = delete;
+
+    ~deferral_guard_t()
     {
-        (obj->*memfn)(std::forward<A1>(a1));
+        for(auto &flush : flushers_)
+            flush();
     }
 
-    template <std::size_t N, typename Obj, typename MemFn, typename A1, typename A2,
-              typename... Rest>
-    static typename std::enable_if<N == 2>::type
-    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, A2 &&a2, Rest &&...)
+private:
+    // Unique 为编译期常量：不去重时不要求参数类型支持 operator==
+    template <typename Unique>
+    void defer_all(Unique, bool)
     {
-        (obj->*memfn)(std::forward<A1>(a1), std::forward<A2>(a2));
     }
 
-    template <std::size_t N, typename Obj, typename MemFn, typename A1, typename A2,
-              typename A3, typename... Rest>
-    static typename std::enable_if<N == 3>::type
-    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, A2 &&a2, A3 &&a3,
-                            Rest &&...)
+    template <typename Unique, typename... Args, typename... Rest>
+    void defer_all(Unique unique, bool scan_all, signal_t<Args...> &sig, Rest &... rest)
     {
-        (obj->*memfn)(std::forward<A1>(a1), std::forward<A2>(a2),
-                      std::forward<A3>(a3));
+        defer_one(unique, scan_all, sig);
+        defer_all(unique, scan_all, rest...);
     }
 
-    template <std::size_t N, typename Obj, typename MemFn, typename A1, typename A2,
-              typename A3, typename A4, typename... Rest>
-    static typename std::enable_if<N == 4>::type
-    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, A2 &&a2, A3 &&a3,
-                            A4 &&a4, Rest &&...)
+    template <typename Unique, typename... Args>
+    void defer_one(Unique unique, bool scan_all, signal_t<Args...> &sig)
     {
-        (obj->*memfn)(std::forward<A1>(a1), std::forward<A2>(a2),
-                      std::forward<A3>(a3), std::forward<A4>(a4));
+        typedef signal_t<Args...> signal_type;
+        typedef typename signal_type::impl_type impl_type;
+        typedef typename impl_type::args_tuple args_tuple;
+        static_assert(std::is_void<typename signal_type::result_type>::value,
+                      "deferral_guard_t only supports signals without return values");
+
+        std::shared_ptr<impl_type> impl = sig.impl_;
+        if(!impl)
+            return;
+
+        impl->begin_deferral(equal_for<args_tuple>(unique),
+                             scan_all ? unique_for<args_tuple>(unique) : nullptr);
+        std::thread::id owner = std::this_thread::get_id();
+        flushers_.push_back([impl, owner]() { signal_type::flush_deferred(*impl, owner); });
     }
 
-    template <std::size_t N, typename Obj, typename MemFn, typename A1, typename A2,
-              typename A3, typename A4, typename A5, typename... Rest>
-    static typename std::enable_if<N == 5>::type
-    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, A2 &&a2, A3 &&a3,
-                            A4 &&a4, A5 &&a5, Rest &&...)
+    template <typename Tuple>
+    static bool tuple_equal(const Tuple &a, const Tuple &b)
     {
-        (obj->*memfn)(std::forward<A1>(a1), std::forward<A2>(a2),
-                      std::forward<A3>(a3), std::forward<A4>(a4),
-                      std::forward<A5>(a5));
+        return a == b;
     }
 
-    template <std::size_t N, typename Obj, typename MemFn, typename A1, typename A2,
-              typename A3, typename A4, typename A5, typename A6, typename... Rest>
-    static typename std::enable_if<N == 6>::type
-    call_member_with_n_args(Obj *obj, MemFn memfn, A1 &&a1, A2 &&a2, A3 &&a3,
-                            A4 &&a4, A5 &&a5, A6 &&a6, Rest &&...)
+    template <typename Tuple>
+    static bool (*equal_for(std::true_type))(const Tuple &, const Tuple &)
     {
-        (obj->*memfn)(std::forward<A1>(a1), std::forward<A2>(a2),
-                      std::forward<A3>(a3), std::forward<A4>(a4),
-                      std::forward<A5>(a5), std::forward<A6>(a6));
+        return &tuple_equal<Tuple>;
     }
 
-    // -------------------------------------------------------------------------
-    // 实际连接实现
-    // -------------------------------------------------------------------------
-    connection_t<Args...> connect_impl(function_type f,
-                                       int p,
-                                       bool ss,
-                                       std::weak_ptr<void> tracked,
-                                       bool has_tracked = false)
+    template <typename Tuple>
+    static bool (*equal_for(std::false_type))(const Tuple &, const Tuple &)
     {
-        if(!impl_)
-            return connection_t<Args...>();
+        return nullptr;
+    }
 
-        auto s = std::make_shared<slot_type>(std::move(f), p, ss, std::move(tracked), has_tracked);
-        {
-            std::lock_guard<std::mutex> lk(impl_->mutex_);
-            impl_->slots_.push_back(s);
-            impl_->dirty_ = true;
-        }
-        return connection_t<Args...>(impl_, s);
+    template <typename Tuple>
+    static void (*unique_for(std::true_type))(std::vector<Tuple> &)
+    {
+        return detail::unique_tuples_for<Tuple>(
+            std::integral_constant<bool, detail::is_tuple_hashable<Tuple>::value>());
     }
 
-    std::shared_ptr<detail::connection_tag> get_or_create_tag(const std::string &name)
+    template <typename Tuple>
+    static void (*unique_for(std::false_type))(std::vector<Tuple> &)
     {
-        std::lock_guard<std::mutex> lk(impl_->mutex_);
-        for(auto &t : impl_->tags_)
-        {
-            if(t && t->name == name)
-                return t;
-        }
-        auto t = std::make_shared<detail::connection_tag>(name);
-        impl_->tags_.push_back(t);
-        return t;
+        return nullptr;
     }
+
+    std::vector<std::function<void()>> flushers_;
 };
 
 // ============================================================================
@@ -1048,6 +5289,501 @@ private:
     std::vector<scoped_connection_t> connections_;
 };
 
+namespace detail {
+
+// ============================================================================
+// 通道公共部分：阻塞读取、满时丢弃计数（CRTP，派生类提供 try_push/try_pop）
+// ============================================================================
+template <typename Derived, typename T>
+class channel_base
+{
+public:
+    typedef T value_type;
+
+    // 阻塞直到取到一个元素
+    void pop(T &out)
+    {
+        Derived &self = derived();
+        ready_.wait_until([&]() { return self.try_pop(out); },
+                          wait_word::clock::time_point::max());
+    }
+
+    // 在 timeout 内取到元素返回 true
+    template <typename Rep, typename Period>
+    bool pop_for(T &out, const std::chrono::duration<Rep, Period> &timeout)
+    {
+        Derived &self = derived();
+        return ready_.wait_until([&]() { return self.try_pop(out); },
+                                 wait_word::deadline_after(timeout));
+    }
+
+    // 作为信号接收端时因通道已满而丢弃的发射数量
+    std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    // 写入失败时计数，供 channel_sink_t 使用
+    template <typename... Us>
+    bool push_or_drop(Us &&... values)
+    {
+        if(derived().try_emplace(std::forward<Us>(values)...))
+            return true;
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+protected:
+    explicit channel_base(std::size_t capacity)
+        : mask_(round_up(capacity) - 1)
+        , storage_(new slot_storage[mask_ + 1])
+        , dropped_(0)
+    {
+    }
+
+    typedef typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type
+        slot_storage;
+
+    T *at(std::size_t index) { return reinterpret_cast<T *>(&storage_[index & mask_]); }
+
+    void notify() { ready_.notify_all(); }
+
+    static std::size_t round_up(std::size_t n)
+    {
+        std::size_t cap = 2;
+        while(cap < n)
+            cap <<= 1;
+        return cap;
+    }
+
+    const std::size_t mask_;
+    std::unique_ptr<slot_storage[]> storage_;
+
+private:
+    Derived &derived() { return static_cast<Derived &>(*this); }
+
+    wait_word ready_;
+    std::atomic<std::uint64_t> dropped_;
+};
+
+} // namespace detail
+
+// ============================================================================
+// spsc_channel_t：单生产者单消费者的有界环形队列
+// 容量向上取整为 2 的幂，元素在预分配的槽中原地构造，读写均无锁、无分配
+// ============================================================================
+template <typename T>
+class spsc_channel_t : public detail::channel_base<spsc_channel_t<T>, T>
+{
+    typedef detail::channel_base<spsc_channel_t<T>, T> base;
+
+public:
+    explicit spsc_channel_t(std::size_t capacity)
+        : base(capacity)
+        , head_(0)
+        , tail_(0)
+        , head_cache_(0)
+        , tail_cache_(0)
+    {
+    }
+
+    spsc_channel_t(const spsc_channel_t &)            = delete;
+    spsc_channel_t &operator=(const spsc_channel_t &) = delete;
+
+    ~spsc_channel_t()
+    {
+        std::size_t tail = tail_.load(std::memory_order_acquire);
+        for(std::size_t i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+            this->at(i)->~T();
+    }
+
+    bool try_push(const T &value) { return try_emplace(value); }
+    bool try_push(T &&value) { return try_emplace(std::move(value)); }
+
+    // 生产者线程调用；通道已满返回 false
+    template <typename... Us>
+    bool try_emplace(Us &&... values)
+    {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if(tail - head_cache_ > this->mask_)
+        {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if(tail - head_cache_ > this->mask_)
+                return false;
+        }
+        new(this->at(tail)) T(std::forward<Us>(values)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        this->notify();
+        return true;
+    }
+
+    // 消费者线程调用；通道为空返回 false
+    bool try_pop(T &out)
+    {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        if(head == tail_cache_)
+        {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if(head == tail_cache_)
+                return false;
+        }
+        T *item = this->at(head);
+        out     = std::move(*item);
+        item->~T();
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 近似值：读写并发时仅供观测
+    std::size_t size() const
+    {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+private:
+    // 读写位置分处不同缓存行，避免生产者与消费者互相失效
+    char pad0_[64];
+    std::atomic<std::size_t> head_; // 消费者写
+    char pad1_[64];
+    std::atomic<std::size_t> tail_; // 生产者写
+    char pad2_[64];
+    std::size_t head_cache_; // 生产者缓存的 head_
+    char pad3_[64];
+    std::size_t tail_cache_; // 消费者缓存的 tail_
+};
+
+// ============================================================================
+// mpsc_channel_t：多生产者单消费者的有界环形队列
+// 每个槽带序号，生产者以 CAS 抢占写入位置，满时立即失败
+// ============================================================================
+template <typename T>
+class mpsc_channel_t : public detail::channel_base<mpsc_channel_t<T>, T>
+{
+    typedef detail::channel_base<mpsc_channel_t<T>, T> base;
+
+public:
+    explicit mpsc_channel_t(std::size_t capacity)
+        : base(capacity)
+        , sequence_(new std::atomic<std::size_t>[this->mask_ + 1])
+        , head_(0)
+        , tail_(0)
+    {
+        for(std::size_t i = 0; i <= this->mask_; ++i)
+            sequence_[i].store(i, std::memory_order_relaxed);
+    }
+
+    mpsc_channel_t(const mpsc_channel_t &)            = delete;
+    mpsc_channel_t &operator=(const mpsc_channel_t &) = delete;
+
+    ~mpsc_channel_t()
+    {
+        for(std::size_t i = head_.load(std::memory_order_relaxed);; ++i)
+        {
+            if(sequence_[i & this->mask_].load(std::memory_order_acquire) != i + 1)
+                break;
+            this->at(i)->~T();
+        }
+    }
+
+    bool try_push(const T &value) { return try_emplace(value); }
+    bool try_push(T &&value) { return try_emplace(std::move(value)); }
+
+    // 任意线程调用；通道已满返回 false
+    template <typename... Us>
+    bool try_emplace(Us &&... values)
+    {
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        for(;;)
+        {
+            std::size_t seq = sequence_[pos & this->mask_].load(std::memory_order_acquire);
+            std::ptrdiff_t diff =
+                static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if(diff == 0)
+            {
+                if(tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+
+        new(this->at(pos)) T(std::forward<Us>(values)...);
+        sequence_[pos & this->mask_].store(pos + 1, std::memory_order_release);
+        this->notify();
+        return true;
+    }
+
+    // 消费者线程调用；通道为空（或下一个槽尚未写完）返回 false
+    bool try_pop(T &out)
+    {
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        if(sequence_[pos & this->mask_].load(std::memory_order_acquire) != pos + 1)
+            return false;
+
+        T *item = this->at(pos);
+        out     = std::move(*item);
+        item->~T();
+        sequence_[pos & this->mask_].store(pos + this->mask_ + 1, std::memory_order_release);
+        head_.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // 近似值：读写并发时仅供观测
+    std::size_t size() const
+    {
+        std::size_t tail = tail_.load(std::memory_order_acquire);
+        std::size_t head = head_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+
+private:
+    std::unique_ptr<std::atomic<std::size_t>[]> sequence_;
+    char pad0_[64];
+    std::atomic<std::size_t> head_; // 只由消费者修改
+    char pad1_[64];
+    std::atomic<std::size_t> tail_; // 生产者竞争
+    char pad2_[64];
+};
+
+// ============================================================================
+// channel_sink_t：把每次发射写入通道的槽函数对象
+// 多参数信号写入 std::tuple 元素类型的通道；通道已满时丢弃并计入 dropped()
+// ============================================================================
+template <typename Channel>
+class channel_sink_t
+{
+public:
+    explicit channel_sink_t(std::shared_ptr<Channel> ch)
+        : channel_(std::move(ch))
+    {
+    }
+
+    template <typename... Us>
+    typename std::enable_if<
+        std::is_constructible<typename Channel::value_type, Us &&...>::value>::type
+    operator()(Us &&... values) const
+    {
+        channel_->push_or_drop(std::forward<Us>(values)...);
+    }
+
+private:
+    std::shared_ptr<Channel> channel_;
+};
+
+// 用法：sig.connect(xswl::to_channel(ch));
+template <typename Channel>
+channel_sink_t<Channel> to_channel(std::shared_ptr<Channel> ch)
+{
+    return channel_sink_t<Channel>(std::move(ch));
+}
+
+namespace detail {
+
+template <typename... Ts>
+struct all_trivially_copyable : std::true_type
+{
+};
+
+template <typename T, typename... Rest>
+struct all_trivially_copyable<T, Rest...>
+    : std::integral_constant<bool, std::is_trivially_copyable<T>::value &&
+                                       all_trivially_copyable<Rest...>::value>
+{
+};
+
+} // namespace detail
+
+// ============================================================================
+// async_signal_queue_t：可在 POSIX 信号处理函数中使用的待发射队列
+// push() 只写预分配的槽与原子变量（Linux 上再写一次 eventfd），不加锁、不分配；
+// 普通线程随后调用 drain()，在自己的上下文中对目标信号执行真正的发射
+// ============================================================================
+template <typename... Args>
+class async_signal_queue_t
+{
+public:
+    using signal_type = signal_t<Args...>;
+    using impl_type   = typename signal_type::impl_type;
+    using args_tuple  = std::tuple<typename std::decay<Args>::type...>;
+
+    static_assert(std::is_void<typename signal_type::result_type>::value,
+                  "async_signal_queue_t only supports signals without return values");
+    static_assert(ATOMIC_POINTER_LOCK_FREE == 2,
+                  "async_signal_queue_t requires lock-free atomics");
+    // 非平凡类型的赋值可能加锁或分配，在信号处理函数中不安全
+    static_assert(detail::all_trivially_copyable<typename std::decay<Args>::type...>::value,
+                  "async_signal_queue_t arguments must be trivially copyable");
+
+    // 容量向上取整为 2 的幂；构造期间分配全部存储
+    async_signal_queue_t(signal_type &target, std::size_t capacity)
+        : impl_(target.impl_)
+        , mask_(round_up(capacity) - 1)
+        , items_(new args_tuple[mask_ + 1])
+        , sequence_(new std::atomic<std::size_t>[mask_ + 1])
+        , head_(0)
+        , tail_(0)
+        , dropped_(0)
+#if defined(__linux__)
+        , fd_(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+#endif
+    {
+        for(std::size_t i = 0; i <= mask_; ++i)
+            sequence_[i].store(i, std::memory_order_relaxed);
+#if defined(__linux__)
+        if(fd_ < 0)
+            throw std::system_error(errno, std::system_category(), "eventfd");
+#endif
+    }
+
+    async_signal_queue_t(const async_signal_queue_t &)            = delete;
+    async_signal_queue_t &operator=(const async_signal_queue_t &) = delete;
+
+    ~async_signal_queue_t()
+    {
+#if defined(__linux__)
+        ::close(fd_);
+#endif
+    }
+
+    // 异步信号安全：可在信号处理函数及任意线程中调用；队列已满时丢弃并返回 false
+    // 参数均为平凡可复制类型（信号编号、pid 等），写入槽时不会分配内存
+    bool push(Args... args)
+    {
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        for(;;)
+        {
+            std::size_t seq = sequence_[pos & mask_].load(std::memory_order_acquire);
+            std::ptrdiff_t diff =
+                static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if(diff == 0)
+            {
+                if(tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(diff < 0)
+            {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+
+        items_[pos & mask_] = args_tuple(args...);
+        sequence_[pos & mask_].store(pos + 1, std::memory_order_release);
+#if defined(__linux__)
+        // 处理函数不得改变被中断代码看到的 errno，写满或出错时 write() 会覆盖它
+        int saved_errno   = errno;
+        std::uint64_t one = 1;
+        ssize_t n         = ::write(fd_, &one, sizeof(one)); // write() 是异步信号安全的
+        (void)n;
+        errno = saved_errno;
+#endif
+        return true;
+    }
+
+    // 在调用线程上对目标信号发射至多 max 次，返回实际发射次数
+    // 不可在信号处理函数中调用；同一时刻只能有一个线程调用
+    std::size_t drain(std::size_t max = (std::numeric_limits<std::size_t>::max)())
+    {
+#if defined(__linux__)
+        std::uint64_t value;
+        ssize_t n = ::read(fd_, &value, sizeof(value)); // 先清除可读状态，之后的 push 会重新置位
+        (void)n;
+#endif
+        std::shared_ptr<impl_type> impl = impl_.lock();
+
+        std::size_t done = 0;
+        while(done < max)
+        {
+            std::size_t pos = head_.load(std::memory_order_relaxed);
+            if(sequence_[pos & mask_].load(std::memory_order_acquire) != pos + 1)
+                break;
+
+            args_tuple item = items_[pos & mask_];
+            sequence_[pos & mask_].store(pos + mask_ + 1, std::memory_order_release);
+            head_.store(pos + 1, std::memory_order_relaxed);
+            ++done;
+
+            if(impl)
+            {
+                auto call = [&impl](Args &... args) { signal_type::emit_to(*impl, args...); };
+                detail::apply_tuple(call, item);
+            }
+        }
+
+#if defined(__linux__)
+        if(done == max && pending() != 0)
+        {
+            std::uint64_t one = 1;
+            n                 = ::write(fd_, &one, sizeof(one)); // 未处理完，保持可读
+        }
+#endif
+        return done;
+    }
+
+    // 近似值：并发写入时仅供观测
+    std::size_t pending() const
+    {
+        std::size_t tail = tail_.load(std::memory_order_acquire);
+        std::size_t head = head_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    // 因队列已满被丢弃的 push 数量
+    std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+#if defined(__linux__)
+    // 有待 drain 的发射时可读，可注册到 epoll，替代手写的 self-pipe
+    int fd() const { return fd_; }
+
+    // 阻塞直到有待 drain 的发射或超时（毫秒，-1 表示一直等待）
+    bool wait(int timeout_ms = -1) const
+    {
+        if(pending() != 0)
+            return true;
+        struct pollfd p;
+        p.fd      = fd_;
+        p.events  = POLLIN;
+        p.revents = 0;
+        return ::poll(&p, 1, timeout_ms) > 0 || pending() != 0;
+    }
+#endif
+
+private:
+    static std::size_t round_up(std::size_t n)
+    {
+        std::size_t cap = 2;
+        while(cap < n)
+            cap <<= 1;
+        return cap;
+    }
+
+    std::weak_ptr<impl_type> impl_;
+    const std::size_t mask_;
+    std::unique_ptr<args_tuple[]> items_;
+    std::unique_ptr<std::atomic<std::size_t>[]> sequence_;
+    std::atomic<std::size_t> head_; // 只由 drain 线程修改
+    std::atomic<std::size_t> tail_;
+    std::atomic<std::uint64_t> dropped_;
+#if defined(__linux__)
+    int fd_;
+#endif
+};
+
 } // namespace xswl
 
 #endif // XSWL_SIGNALS_H
@@ -0,0 +1,108 @@
+#include "test_common.hpp"
+
+// 测试：所属线程发射时直接调用槽
+TEST_CASE(affinity_same_thread_is_direct)
+{
+    xswl::signal_t<int> sig;
+    int value = 0;
+    sig.connect([&value](int v) { value = v; }, xswl::connect_options_t().thread_affine());
+
+    sig(5);
+    ASSERT_EQ(value, 5);
+    ASSERT_TRUE(xswl::this_thread_loop()->empty());
+}
+
+// 测试：其他线程发射时排队到所属线程的本地队列，由所属线程 drain 时在本线程调用
+TEST_CASE(affinity_cross_thread_is_queued)
+{
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+    std::thread::id called_on;
+    const std::thread::id owner = std::this_thread::get_id();
+
+    auto conn = sig.connect([&](int v) {
+        received.push_back(v); // 只在所属线程上访问，无需加锁
+        called_on = std::this_thread::get_id();
+    }, xswl::connect_options_t().thread_affine());
+
+    std::thread worker([&sig]() {
+        sig(1);
+        sig(2);
+    });
+    worker.join();
+
+    ASSERT_TRUE(received.empty());
+    ASSERT_EQ(conn.queue_stats().pending, 2u);
+
+    xswl::this_thread_loop()->drain();
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[0], 1);
+    ASSERT_EQ(received[1], 2);
+    ASSERT_TRUE(called_on == owner);
+}
+
+// 测试：亲和于工作线程的连接，主线程发射后由工作线程在检查点处理
+TEST_CASE(affinity_worker_thread_checkpoint)
+{
+    xswl::signal_t<int> sig;
+    std::atomic<bool> connected{false};
+    std::atomic<bool> stop{false};
+    std::atomic<int> total{0};
+    std::atomic<bool> wrong_thread{false};
+
+    std::thread worker([&]() {
+        const std::thread::id self = std::this_thread::get_id();
+        sig.connect([&, self](int v) {
+            if (std::this_thread::get_id() != self)
+                wrong_thread.store(true);
+            total.fetch_add(v);
+        }, xswl::connect_options_t().thread_affine());
+        connected.store(true);
+
+        while (!stop.load())
+        {
+            xswl::this_thread_loop()->drain(); // 检查点
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        xswl::this_thread_loop()->drain();
+    });
+
+    while (!connected.load())
+        std::this_thread::yield();
+    for (int i = 1; i <= 100; ++i)
+        sig(i);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (total.load() < 5050 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    stop.store(true);
+    worker.join();
+
+    ASSERT_EQ(total.load(), 5050);
+    ASSERT_FALSE(wrong_thread.load());
+}
+
+// 测试：所属线程退出后，其他线程的发射被丢弃而不会崩溃
+TEST_CASE(affinity_owner_thread_exited)
+{
+    xswl::signal_t<int> sig;
+    Counter counter;
+
+    std::thread owner([&]() {
+        sig.connect([&counter](int) { counter.increment(); },
+                    xswl::connect_options_t().thread_affine());
+    });
+    owner.join();
+
+    sig(1);
+    ASSERT_EQ(counter.get(), 0);
+}
+
+// 测试：返回值信号拒绝线程亲和选项
+TEST_CASE(affinity_rejected_for_return_signals)
+{
+    xswl::signal_t<int()> sig;
+    ASSERT_THROWS(sig.connect([]() { return 1; }, xswl::connect_options_t().thread_affine()),
+                  std::invalid_argument);
+    ASSERT_TRUE(sig.empty());
+}
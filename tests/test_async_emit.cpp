@@ -0,0 +1,112 @@
+#include "test_common.hpp"
+
+// 测试：异步发射在执行器上按优先级顺序调用全部槽，future 在完成后就绪
+TEST_CASE(emit_async_runs_all_slots_in_order)
+{
+    xswl::signal_t<int> sig;
+    std::vector<int> order;
+    std::thread::id caller = std::this_thread::get_id();
+    std::atomic<bool> other_thread{false};
+
+    sig.connect([&](int v) { order.push_back(v * 1); }, 1);
+    sig.connect([&](int v) {
+        order.push_back(v * 10);
+        other_thread.store(std::this_thread::get_id() != caller);
+    }, 10);
+    sig.connect([&](int v) { order.push_back(v * 5); }, 5);
+
+    std::future<void> done = sig.emit_async(2);
+    done.wait();
+
+    ASSERT_TRUE(other_thread.load());
+    ASSERT_EQ(order.size(), 3u);
+    ASSERT_EQ(order[0], 20);
+    ASSERT_EQ(order[1], 10);
+    ASSERT_EQ(order[2], 2);
+}
+
+// 测试：指定事件循环作为执行器，drain 前不会执行
+TEST_CASE(emit_async_on_event_loop)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<std::string> sig;
+    std::string received;
+
+    sig.connect([&received](const std::string &s) { received = s; });
+
+    std::string payload = "payload";
+    auto done = sig.emit_async_on(loop, payload);
+    payload.clear(); // 参数已按值保存
+
+    ASSERT_EQ(done.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+    ASSERT_TRUE(received.empty());
+
+    loop->drain();
+    ASSERT_EQ(done.wait_for(std::chrono::milliseconds(0)), std::future_status::ready);
+    ASSERT_EQ(received, "payload");
+}
+
+// 测试：返回值信号的异步发射通过 future 取得默认合并器结果
+TEST_CASE(emit_async_return_value)
+{
+    xswl::signal_t<int(int, int)> sig;
+    sig.connect([](int a, int b) { return a * b; }, 1);
+    sig.connect([](int a, int b) { return a + b; }, 0);
+
+    std::future<int> result = sig.emit_async(6, 7);
+    ASSERT_EQ(result.get(), 13);
+
+    xswl::signal_t<int()> empty;
+    ASSERT_EQ(empty.emit_async().get(), 0);
+}
+
+// 测试：发射后信号对象销毁，已提交的异步发射仍安全完成
+TEST_CASE(emit_async_outlives_signal)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    Counter counter;
+    std::future<void> done;
+    {
+        xswl::signal_t<> sig;
+        sig.connect([&counter]() { counter.increment(); });
+        done = sig.emit_async_on(loop);
+    }
+
+    loop->drain();
+    done.get();
+    ASSERT_EQ(counter.get(), 0); // 信号销毁时已断开全部连接
+}
+
+// 测试：自建线程池并发执行多次异步发射
+TEST_CASE(emit_async_thread_pool)
+{
+    auto pool = std::make_shared<xswl::thread_pool_t>(4);
+    ASSERT_EQ(pool->size(), 4u);
+
+    xswl::signal_t<int> sig;
+    std::atomic<int> total{0};
+    sig.connect([&total](int v) { total.fetch_add(v); });
+
+    std::vector<std::future<void>> pending;
+    for (int i = 1; i <= 100; ++i)
+        pending.push_back(sig.emit_async_on(pool, i));
+    for (auto &f : pending)
+        f.wait();
+
+    ASSERT_EQ(total.load(), 5050);
+}
+
+// 测试：线程池的最后一个引用在它自己的任务中释放，析构不会 join 自身，剩余任务照常执行
+TEST_CASE(thread_pool_destroyed_on_own_worker)
+{
+    auto pool   = std::make_shared<xswl::thread_pool_t>(1);
+    auto holder = std::make_shared<std::shared_ptr<xswl::thread_pool_t>>(pool);
+    std::promise<void> done;
+    std::future<void> finished = done.get_future();
+
+    pool->post([holder]() { holder->reset(); });
+    pool->post([&done]() { done.set_value(); });
+    pool.reset();
+
+    ASSERT_TRUE(finished.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+}
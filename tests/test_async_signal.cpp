@@ -0,0 +1,128 @@
+#include "test_common.hpp"
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+
+// 测试：push 只入队，drain 时在调用线程上发射
+TEST_CASE(async_signal_queue_push_and_drain)
+{
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+    sig.connect([&received](int v) { received.push_back(v); });
+
+    xswl::async_signal_queue_t<int> queue(sig, 4);
+    ASSERT_EQ(queue.capacity(), 4u);
+
+    ASSERT_TRUE(queue.push(1));
+    ASSERT_TRUE(queue.push(2));
+    ASSERT_TRUE(received.empty());
+    ASSERT_EQ(queue.pending(), 2u);
+
+    ASSERT_EQ(queue.drain(), 2u);
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[0], 1);
+    ASSERT_EQ(received[1], 2);
+    ASSERT_EQ(queue.pending(), 0u);
+}
+
+// 测试：队列满时丢弃并计数；drain(max) 分批处理
+TEST_CASE(async_signal_queue_overflow_and_batches)
+{
+    xswl::signal_t<int> sig;
+    Counter counter;
+    sig.connect([&counter](int) { counter.increment(); });
+
+    xswl::async_signal_queue_t<int> queue(sig, 4);
+    for (int i = 0; i < 6; ++i)
+        queue.push(i);
+    ASSERT_EQ(queue.dropped(), 2u);
+
+    ASSERT_EQ(queue.drain(3), 3u);
+    ASSERT_EQ(queue.drain(3), 1u);
+    ASSERT_EQ(counter.get(), 4);
+}
+
+#if defined(__linux__)
+
+static xswl::async_signal_queue_t<int> *g_os_signals = nullptr;
+
+extern "C" void forward_os_signal(int signo)
+{
+    g_os_signals->push(signo);
+}
+
+// 测试：在真正的 POSIX 信号处理函数中入队，fd 可读后由普通线程 drain
+TEST_CASE(async_signal_queue_from_signal_handler)
+{
+    xswl::signal_t<int> on_os_signal;
+    std::vector<int> received;
+    on_os_signal.connect([&received](int signo) { received.push_back(signo); });
+
+    xswl::async_signal_queue_t<int> queue(on_os_signal, 16);
+    g_os_signals = &queue;
+
+    struct sigaction action;
+    struct sigaction previous;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = forward_os_signal;
+    sigemptyset(&action.sa_mask);
+    ASSERT_EQ(::sigaction(SIGUSR1, &action, &previous), 0);
+
+    ::raise(SIGUSR1);
+    ::raise(SIGUSR1);
+
+    ASSERT_TRUE(queue.wait(1000));
+    ASSERT_EQ(queue.drain(), 2u);
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[0], SIGUSR1);
+    ASSERT_FALSE(queue.wait(0));
+
+    ::sigaction(SIGUSR1, &previous, nullptr);
+    g_os_signals = nullptr;
+}
+
+// 测试：eventfd 计数已满时 write() 失败，push 仍保持调用方的 errno 不变
+TEST_CASE(async_signal_queue_push_preserves_errno)
+{
+    xswl::signal_t<int> sig;
+    Counter counter;
+    sig.connect([&counter](int) { counter.increment(); });
+
+    xswl::async_signal_queue_t<int> queue(sig, 4);
+    std::uint64_t full = 0xfffffffffffffffeULL;
+    ASSERT_EQ(::write(queue.fd(), &full, sizeof(full)), static_cast<ssize_t>(sizeof(full)));
+
+    errno = 0;
+    ASSERT_TRUE(queue.push(1));
+    ASSERT_EQ(errno, 0);
+
+    ASSERT_EQ(queue.drain(), 1u);
+    ASSERT_EQ(counter.get(), 1);
+}
+
+// 测试：其他线程 push，消费线程阻塞等待 fd 后 drain
+TEST_CASE(async_signal_queue_cross_thread_wait)
+{
+    xswl::signal_t<int, long> sig;
+    std::atomic<long> total{0};
+    sig.connect([&total](int, long v) { total.fetch_add(v); });
+
+    xswl::async_signal_queue_t<int, long> queue(sig, 1024);
+    std::thread producer([&queue]() {
+        for (int i = 1; i <= 100; ++i)
+            queue.push(0, i);
+    });
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (total.load() < 5050 && std::chrono::steady_clock::now() < deadline)
+    {
+        if (queue.wait(100))
+            queue.drain();
+    }
+    producer.join();
+
+    ASSERT_EQ(total.load(), 5050);
+}
+
+#endif
@@ -0,0 +1,278 @@
+#include "test_common.hpp"
+
+// 轮询等待条件成立，超时返回 false
+template <typename Pred>
+static bool wait_until_true(Pred pred, int timeout_ms = 2000)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (!pred())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+// 测试：drop_newest 在邮箱满时丢弃本次发射
+TEST_CASE(bounded_queue_drop_newest)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+
+    auto conn = sig.connect([&received](int v) { received.push_back(v); },
+                            xswl::connect_options_t().queued(loop).capacity(3).overflow(
+                                xswl::overflow_t::drop_newest));
+
+    for (int i = 0; i < 10; ++i)
+        sig(i);
+
+    xswl::queue_stats_t stats = conn.queue_stats();
+    ASSERT_EQ(stats.pending, 3u);
+    ASSERT_EQ(stats.capacity, 3u);
+    ASSERT_EQ(stats.dropped, 7u);
+    ASSERT_EQ(stats.blocked, 0u);
+
+    loop->drain();
+    ASSERT_EQ(received.size(), 3u);
+    ASSERT_EQ(received[0], 0);
+    ASSERT_EQ(received[2], 2);
+    ASSERT_EQ(conn.queue_stats().pending, 0u);
+}
+
+// 测试：drop_oldest 保留最新的若干次发射
+TEST_CASE(bounded_queue_drop_oldest)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+
+    auto conn = sig.connect([&received](int v) { received.push_back(v); },
+                            xswl::connect_options_t().queued(loop).capacity(3));
+
+    for (int i = 0; i < 10; ++i)
+        sig(i);
+
+    ASSERT_EQ(conn.queue_stats().dropped, 7u);
+    loop->drain();
+    ASSERT_EQ(received.size(), 3u);
+    ASSERT_EQ(received[0], 7);
+    ASSERT_EQ(received[1], 8);
+    ASSERT_EQ(received[2], 9);
+}
+
+// 测试：coalesce 在满时覆盖最新的积压，较早的积压保持不变
+TEST_CASE(bounded_queue_coalesce)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+
+    auto conn = sig.connect([&received](int v) { received.push_back(v); },
+                            xswl::connect_options_t().queued(loop).capacity(2).overflow(
+                                xswl::overflow_t::coalesce));
+
+    for (int i = 0; i < 10; ++i)
+        sig(i);
+
+    ASSERT_EQ(conn.queue_stats().dropped, 8u);
+    loop->drain();
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[0], 0);
+    ASSERT_EQ(received[1], 9);
+}
+
+// 测试：block 策略让生产者等待消费者，不丢失任何发射
+TEST_CASE(bounded_queue_block)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+    std::atomic<bool> producer_done{false};
+
+    auto conn = sig.connect([&received](int v) { received.push_back(v); },
+                            xswl::connect_options_t().queued(loop).capacity(4).overflow(
+                                xswl::overflow_t::block));
+
+    const int n = 200;
+    std::thread producer([&]() {
+        for (int i = 0; i < n; ++i)
+            sig(i);
+        producer_done.store(true);
+    });
+
+    // 先让生产者撞上容量上限，再开始消费
+    while (conn.queue_stats().blocked == 0)
+        std::this_thread::yield();
+
+    std::size_t max_pending = 0;
+    while (!producer_done.load() || !loop->empty())
+    {
+        max_pending = (std::max)(max_pending, conn.queue_stats().pending);
+        loop->drain();
+        std::this_thread::yield();
+    }
+    producer.join();
+    loop->drain();
+
+    ASSERT_LE(max_pending, 4u);
+    ASSERT_EQ(received.size(), static_cast<std::size_t>(n));
+    for (int i = 0; i < n; ++i)
+        ASSERT_EQ(received[i], i);
+
+    xswl::queue_stats_t stats = conn.queue_stats();
+    ASSERT_EQ(stats.dropped, 0u);
+    ASSERT_GT(stats.blocked, 0u);
+}
+
+// 测试：block 策略下执行器销毁，阻塞的发射放弃而不是永久等待
+TEST_CASE(bounded_queue_block_executor_destroyed)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+
+    auto conn = sig.connect([](int) {},
+                            xswl::connect_options_t().queued(loop).capacity(1).overflow(
+                                xswl::overflow_t::block));
+    sig(1);
+
+    std::thread killer([&loop]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        loop.reset();
+    });
+    sig(2); // 邮箱已满，等待直到执行器销毁
+    killer.join();
+
+    ASSERT_EQ(conn.queue_stats().blocked, 1u);
+    ASSERT_EQ(conn.queue_stats().dropped, 1u);
+}
+
+// 测试：block 策略下发射线程就是 drain 执行器的线程时，放弃发射而不是永久等待
+TEST_CASE(bounded_queue_block_on_executor_thread)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+
+    auto conn = sig.connect([&received](int v) { received.push_back(v); },
+                            xswl::connect_options_t().queued(loop).capacity(2).overflow(
+                                xswl::overflow_t::block));
+
+    // 在同一执行器的其他任务中发射
+    loop->post([&sig]() {
+        for (int i = 10; i < 15; ++i)
+            sig(i);
+    });
+    loop->drain();
+    ASSERT_EQ(conn.queue_stats().dropped, 3u);
+    loop->drain();
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[1], 11);
+}
+
+// 测试：多线程池的工作线程向已满邮箱发射时照常等待，其他工作线程交付后不丢失发射
+TEST_CASE(bounded_queue_block_on_pool_worker)
+{
+    auto pool = std::make_shared<xswl::thread_pool_t>(4);
+    xswl::signal_t<int> sig;
+    std::mutex mutex;
+    std::vector<int> received;
+
+    auto conn = sig.connect([&](int v) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> lk(mutex);
+        received.push_back(v);
+    }, xswl::connect_options_t().queued(pool).capacity(2).overflow(xswl::overflow_t::block));
+
+    const int n = 20;
+    std::atomic<bool> emitted{false};
+    pool->post([&]() {
+        for (int i = 0; i < n; ++i)
+            sig(i);
+        emitted.store(true);
+    });
+
+    ASSERT_TRUE(wait_until_true([&]() {
+        std::lock_guard<std::mutex> lk(mutex);
+        return emitted.load() && received.size() == static_cast<std::size_t>(n);
+    }));
+
+    xswl::queue_stats_t stats = conn.queue_stats();
+    ASSERT_EQ(stats.dropped, 0u);
+    ASSERT_GT(stats.blocked, 0u);
+    std::lock_guard<std::mutex> lk(mutex);
+    for (int i = 0; i < n; ++i)
+        ASSERT_EQ(received[i], i);
+}
+
+// 测试：单线程池的唯一工作线程向已满邮箱发射时放弃发射，而不是永久等待
+TEST_CASE(bounded_queue_block_on_single_worker_pool)
+{
+    auto pool = std::make_shared<xswl::thread_pool_t>(1);
+    xswl::signal_t<int> sig;
+    std::atomic<int> received{0};
+
+    auto conn = sig.connect([&received](int) { received.fetch_add(1); },
+                            xswl::connect_options_t().queued(pool).capacity(2).overflow(
+                                xswl::overflow_t::block));
+
+    pool->post([&sig]() {
+        for (int i = 0; i < 5; ++i)
+            sig(i);
+    });
+
+    ASSERT_TRUE(wait_until_true([&]() { return received.load() == 2; }));
+    ASSERT_EQ(conn.queue_stats().dropped, 3u);
+}
+
+// 测试：曾经 drain 过的线程在 drain 之外发射时照常等待，不会被当作执行器线程而丢弃
+TEST_CASE(bounded_queue_block_after_drain_elsewhere)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+    std::atomic<bool> producer_done{false};
+
+    auto conn = sig.connect([&received](int v) { received.push_back(v); },
+                            xswl::connect_options_t().queued(loop).capacity(2).overflow(
+                                xswl::overflow_t::block));
+
+    std::thread producer([&]() {
+        loop->drain();
+        for (int i = 0; i < 5; ++i)
+            sig(i);
+        producer_done.store(true);
+    });
+
+    while (!producer_done.load() || !loop->empty())
+    {
+        loop->drain();
+        std::this_thread::yield();
+    }
+    producer.join();
+    loop->drain();
+
+    ASSERT_EQ(conn.queue_stats().dropped, 0u);
+    ASSERT_EQ(received.size(), 5u);
+}
+
+// 测试：非排队连接的统计为 0，节流包装的排队连接可以查询内层邮箱
+TEST_CASE(bounded_queue_stats_passthrough)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+
+    auto direct = sig.connect([](int) {});
+    ASSERT_EQ(direct.queue_stats().capacity, 0u);
+    ASSERT_EQ(direct.queue_stats().pending, 0u);
+
+    auto limited = sig.connect([](int) {}, xswl::connect_options_t()
+                                               .queued(loop)
+                                               .capacity(8)
+                                               .throttle(std::chrono::seconds(10)));
+    sig(1);
+    sig(2);
+    ASSERT_EQ(limited.queue_stats().capacity, 8u);
+    ASSERT_EQ(limited.queue_stats().pending, 1u);
+}
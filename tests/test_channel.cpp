@@ -0,0 +1,142 @@
+#include "test_common.hpp"
+
+// 测试：SPSC 通道容量取整为 2 的幂，满时写入失败，按 FIFO 读出
+TEST_CASE(spsc_channel_basic)
+{
+    xswl::spsc_channel_t<int> ch(3);
+    ASSERT_EQ(ch.capacity(), 4u);
+    ASSERT_TRUE(ch.empty());
+
+    for (int i = 0; i < 4; ++i)
+        ASSERT_TRUE(ch.try_push(i));
+    ASSERT_FALSE(ch.try_push(99));
+    ASSERT_EQ(ch.size(), 4u);
+
+    int v = -1;
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(ch.try_pop(v));
+        ASSERT_EQ(v, i);
+    }
+    ASSERT_FALSE(ch.try_pop(v));
+    ASSERT_FALSE(ch.pop_for(v, std::chrono::milliseconds(5)));
+}
+
+// 测试：SPSC 通道跨线程传递，消费者阻塞读取不丢失、不乱序
+TEST_CASE(spsc_channel_cross_thread)
+{
+    auto ch = std::make_shared<xswl::spsc_channel_t<int>>(64);
+    xswl::signal_t<int> sig;
+    sig.connect(xswl::to_channel(ch));
+
+    const int n = 100000;
+    std::thread producer([&]() {
+        for (int i = 0; i < n; ++i)
+        {
+            while (ch->size() == ch->capacity())
+                std::this_thread::yield(); // 测试中不丢弃：等消费者腾出空间
+            sig(i);
+        }
+    });
+
+    bool in_order = true;
+    for (int i = 0; i < n; ++i)
+    {
+        int v = -1;
+        ch->pop(v);
+        if (v != i)
+            in_order = false;
+    }
+    producer.join();
+
+    ASSERT_TRUE(in_order);
+    ASSERT_EQ(ch->dropped(), 0u);
+}
+
+// 测试：MPSC 通道多生产者并发写入，每个生产者内部保持顺序
+TEST_CASE(mpsc_channel_multi_producer)
+{
+    auto ch = std::make_shared<xswl::mpsc_channel_t<std::pair<int, int>>>(256);
+    const int producers = 4;
+    const int per_producer = 20000;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&ch, p]() {
+            for (int i = 0; i < per_producer; ++i)
+            {
+                while (!ch->try_push(std::make_pair(p, i)))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<int> next(producers, 0);
+    bool in_order = true;
+    for (int k = 0; k < producers * per_producer; ++k)
+    {
+        std::pair<int, int> item;
+        if (!ch->pop_for(item, std::chrono::seconds(5)))
+        {
+            in_order = false;
+            break;
+        }
+        if (item.second != next[item.first])
+            in_order = false;
+        ++next[item.first];
+    }
+    for (auto &t : threads)
+        t.join();
+
+    ASSERT_TRUE(in_order);
+    ASSERT_TRUE(ch->empty());
+}
+
+// 测试：多参数信号写入 tuple 通道；通道满时丢弃并计数
+TEST_CASE(channel_sink_tuple_and_drop)
+{
+    auto ch = std::make_shared<xswl::mpsc_channel_t<std::tuple<int, std::string>>>(2);
+    xswl::signal_t<int, std::string> sig;
+    sig.connect(xswl::to_channel(ch));
+
+    sig(1, "a");
+    sig(2, "b");
+    sig(3, "c");
+    ASSERT_EQ(ch->dropped(), 1u);
+
+    std::tuple<int, std::string> item;
+    ASSERT_TRUE(ch->try_pop(item));
+    ASSERT_EQ(std::get<0>(item), 1);
+    ASSERT_EQ(std::get<1>(item), "a");
+    ASSERT_TRUE(ch->try_pop(item));
+    ASSERT_EQ(std::get<1>(item), "b");
+    ASSERT_FALSE(ch->try_pop(item));
+}
+
+// 测试：通道元素类型只接收部分参数时，按参数适配规则截断
+TEST_CASE(channel_sink_arg_adaptation)
+{
+    auto ch = std::make_shared<xswl::spsc_channel_t<int>>(8);
+    xswl::signal_t<int, std::string> sig;
+    sig.connect(xswl::to_channel(ch));
+
+    sig(42, "ignored");
+    int v = 0;
+    ASSERT_TRUE(ch->try_pop(v));
+    ASSERT_EQ(v, 42);
+}
+
+// 测试：通道析构时销毁未读出的元素
+TEST_CASE(channel_destroys_pending_items)
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        xswl::spsc_channel_t<std::shared_ptr<int>> spsc(4);
+        xswl::mpsc_channel_t<std::shared_ptr<int>> mpsc(4);
+        spsc.try_push(tracker);
+        mpsc.try_push(tracker);
+        ASSERT_EQ(tracker.use_count(), 3);
+    }
+    ASSERT_EQ(tracker.use_count(), 1);
+}
@@ -0,0 +1,153 @@
+#include "test_common.hpp"
+
+// 测试：返回值信号默认返回最后一个（最低优先级）槽的结果
+TEST_CASE(return_signal_last_value)
+{
+    xswl::signal_t<int(int)> sig;
+
+    ASSERT_EQ(sig(1), 0); // 没有槽时返回 R()
+
+    sig.connect([](int v) { return v * 10; }, 10);
+    sig.connect([](int v) { return v + 1; }, 0);
+
+    ASSERT_EQ(sig(5), 6);
+    ASSERT_EQ(sig.emit_signal(7), 8);
+}
+
+// 测试：求和与最小/最大值合并器
+TEST_CASE(return_signal_sum_min_max)
+{
+    xswl::signal_t<int(int)> sig;
+    sig.connect([](int v) { return v; });
+    sig.connect([](int v) { return v * 2; });
+    sig.connect([](int v) { return v - 10; });
+
+    ASSERT_EQ(sig.combine(xswl::sum_t<int>(), 3), 3 + 6 - 7);
+    ASSERT_EQ(sig.combine(xswl::sum_t<int>(100), 3), 100 + 3 + 6 - 7);
+    ASSERT_EQ(sig.combine(xswl::min_t<int>(), 3), -7);
+    ASSERT_EQ(sig.combine(xswl::max_t<int>(), 3), 6);
+
+    xswl::signal_t<int()> none;
+    xswl::max_t<int> m;
+    none.combine(m);
+    ASSERT_FALSE(m.has_value());
+}
+
+// 测试：收集到调用者缓冲区，写满后跳过剩余槽
+TEST_CASE(return_signal_collect_buffer)
+{
+    xswl::signal_t<int()> sig;
+    Counter calls;
+    for (int i = 0; i < 5; ++i)
+        sig.connect([i, &calls]() { calls.increment(); return i; }, 10 - i);
+
+    int buffer[3] = {0, 0, 0};
+    xswl::collect_t<int> collector(buffer);
+    std::size_t n = sig.combine(collector);
+
+    ASSERT_EQ(n, 3u);
+    ASSERT_EQ(collector.result(), 3u);
+    ASSERT_EQ(buffer[0], 0);
+    ASSERT_EQ(buffer[1], 1);
+    ASSERT_EQ(buffer[2], 2);
+    ASSERT_EQ(calls.get(), 3); // 第 4、5 个槽被短路
+
+    std::vector<int> big(8, -1);
+    ASSERT_EQ(sig.combine(xswl::collect_t<int>(big.data(), big.size())), 5u);
+    ASSERT_EQ(big[4], 4);
+    ASSERT_EQ(big[5], -1);
+}
+
+// 测试：第一个非空结果，找到后不再调用低优先级槽
+TEST_CASE(return_signal_first_non_null)
+{
+    struct Handler
+    {
+        const char *name;
+    };
+    static Handler low = {"low"};
+    static Handler high = {"high"};
+
+    xswl::signal_t<Handler *(const std::string &)> route;
+    Counter low_calls;
+
+    route.connect([](const std::string &) -> Handler * { return nullptr; }, 100);
+    route.connect([](const std::string &key) -> Handler * {
+        return key == "hit" ? &high : nullptr;
+    }, 50);
+    route.connect([&low_calls](const std::string &) -> Handler * {
+        low_calls.increment();
+        return &low;
+    }, 0);
+
+    ASSERT_TRUE(route.combine(xswl::first_non_null_t<Handler *>(), "hit") == &high);
+    ASSERT_EQ(low_calls.get(), 0);
+
+    ASSERT_TRUE(route.combine(xswl::first_non_null_t<Handler *>(), "miss") == &low);
+    ASSERT_EQ(low_calls.get(), 1);
+}
+
+// 测试：返回值信号支持成员函数、参数适配、单次与标签连接
+TEST_CASE(return_signal_connection_kinds)
+{
+    struct Calc
+    {
+        int base;
+        int add(int a, int b) const { return base + a + b; }
+        int first(int a) { return base + a; }
+    };
+
+    xswl::signal_t<int(int, int)> sig;
+    auto calc = std::make_shared<Calc>();
+    calc->base = 100;
+    Calc raw = {1000};
+
+    sig.connect(calc, &Calc::add);
+    ASSERT_EQ(sig(1, 2), 103);
+
+    auto conn = sig.connect(&raw, &Calc::first, -1);
+    ASSERT_EQ(sig(1, 2), 1001);
+    conn.disconnect();
+
+    sig.connect_once([](int a) { return a * 1000; }, -5);
+    ASSERT_EQ(sig(3, 0), 3000);
+    ASSERT_EQ(sig(3, 0), 103);
+
+    sig.connect("tagged", []() { return -1; }, -10);
+    ASSERT_EQ(sig(0, 0), -1);
+    ASSERT_TRUE(sig.disconnect("tagged"));
+
+    calc.reset(); // 跟踪对象销毁后槽失效
+    ASSERT_EQ(sig.slot_count(), 1u);
+    ASSERT_EQ(sig(0, 0), 0);
+    ASSERT_EQ(sig.slot_count(), 0u);
+}
+
+// 测试：void(Args...) 形式与可变参数形式行为一致
+TEST_CASE(return_signal_void_form)
+{
+    xswl::signal_t<void(int)> sig;
+    int total = 0;
+    sig.connect([&total](int v) { total += v; });
+    sig.connect([&total](int v) { total += v * 2; });
+    sig(5);
+    ASSERT_EQ(total, 15);
+}
+
+// 测试：返回值信号拒绝排队与限流选项，连接时抛出 std::invalid_argument
+TEST_CASE(return_signal_rejects_async_options)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int()> sig;
+
+    ASSERT_THROWS(sig.connect([]() { return 1; }, xswl::connect_options_t().queued(loop)),
+                  std::invalid_argument);
+    ASSERT_THROWS(sig.connect([]() { return 1; },
+                              xswl::connect_options_t().throttle(std::chrono::milliseconds(5))),
+                  std::invalid_argument);
+    ASSERT_TRUE(sig.empty());
+
+    auto ok = sig.connect([]() { return 2; }, xswl::connect_options_t(5));
+    ASSERT_TRUE(ok.is_connected());
+    ASSERT_EQ(sig(), 2);
+}
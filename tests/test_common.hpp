@@ -41,6 +41,17 @@
 #define ASSERT_LT(a, b)    ASSERT_TRUE((a) < (b))
 #define ASSERT_LE(a, b)    ASSERT_TRUE((a) <= (b))
 
+#define ASSERT_THROWS(expr, type) \
+    do { \
+        bool thrown_ = false; \
+        try { expr; } catch (const type &) { thrown_ = true; } \
+        if (!thrown_) { \
+            std::ostringstream oss; \
+            oss << "Expected " #type " from " #expr " at " << __FILE__ << ":" << __LINE__; \
+            throw std::runtime_error(oss.str()); \
+        } \
+    } while(0)
+
 // 测试运行器
 class TestRunner
 {
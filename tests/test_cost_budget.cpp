@@ -0,0 +1,129 @@
+#include "test_common.hpp"
+
+// 测试：未超出预算的槽不被标记，平均耗时可查询
+TEST_CASE(cost_budget_fast_slot)
+{
+    xswl::signal_t<int> sig;
+    int total = 0;
+    auto conn = sig.connect([&total](int v) { total += v; },
+                            xswl::connect_options_t().budget(std::chrono::milliseconds(50)));
+
+    for (int i = 0; i < 10; ++i)
+        sig(1);
+
+    ASSERT_EQ(total, 10);
+    xswl::slot_cost_t cost = conn.cost();
+    ASSERT_EQ(cost.budget.count(), std::chrono::nanoseconds(std::chrono::milliseconds(50)).count());
+    ASSERT_LT(cost.average.count(), cost.budget.count());
+    ASSERT_FALSE(cost.slow);
+    ASSERT_FALSE(conn.is_slow());
+}
+
+// 测试：平均耗时超出预算时标记为慢槽，变快后标记解除
+TEST_CASE(cost_budget_flags_slow_slot)
+{
+    xswl::signal_t<int> sig;
+    auto conn = sig.connect([](int ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }, xswl::connect_options_t().budget(std::chrono::milliseconds(1)));
+
+    for (unsigned i = 0; i < 7; ++i)
+        sig(2);
+    ASSERT_FALSE(conn.is_slow()); // 预热窗口内不标记
+    sig(2);
+    ASSERT_TRUE(conn.is_slow());
+    ASSERT_GE(conn.cost().average.count(),
+              std::chrono::nanoseconds(std::chrono::milliseconds(2)).count());
+
+    for (int i = 0; i < 100 && conn.is_slow(); ++i)
+        sig(0);
+    ASSERT_FALSE(conn.is_slow());
+    ASSERT_FALSE(conn.cost().offloaded);
+}
+
+// 测试：设置 offload 执行器后，慢槽之后的发射排队执行，发射线程不再被拖慢
+TEST_CASE(cost_budget_offloads_slow_slot)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+
+    auto conn = sig.connect([&received](int v) {
+        received.push_back(v);
+        if (v == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }, xswl::connect_options_t().budget(std::chrono::milliseconds(1)).offload(loop));
+
+    for (int i = 0; i < 8; ++i)
+        sig(0); // 同步执行，预热结束时超出预算后迁移
+    ASSERT_EQ(received.size(), 8u);
+    ASSERT_TRUE(conn.cost().offloaded);
+
+    sig(1);
+    sig(2);
+    ASSERT_EQ(received.size(), 8u);
+    ASSERT_EQ(conn.queue_stats().pending, 2u);
+
+    loop->drain();
+    ASSERT_EQ(received.size(), 10u);
+    ASSERT_EQ(received[9], 2);
+}
+
+// 测试：只有首次调用很慢（冷启动）时不标记、不迁移
+TEST_CASE(cost_budget_ignores_slow_first_call)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    int calls = 0;
+    auto conn = sig.connect([&calls](int ms) {
+        ++calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }, xswl::connect_options_t().budget(std::chrono::milliseconds(1)).offload(loop));
+
+    sig(10);
+    for (int i = 0; i < 20; ++i)
+        sig(0);
+
+    ASSERT_EQ(calls, 21); // 全部同步执行
+    ASSERT_TRUE(loop->empty());
+    ASSERT_FALSE(conn.is_slow());
+    ASSERT_FALSE(conn.cost().offloaded);
+    ASSERT_LT(conn.cost().average.count(),
+              std::chrono::nanoseconds(std::chrono::milliseconds(1)).count());
+}
+
+// 测试：未设置预算的连接开销为 0；返回值信号拒绝预算选项
+TEST_CASE(cost_budget_defaults_and_rejection)
+{
+    xswl::signal_t<> sig;
+    auto plain = sig.connect([]() {});
+    ASSERT_EQ(plain.cost().budget.count(), 0);
+    ASSERT_FALSE(plain.is_slow());
+
+    xswl::signal_t<int()> ret;
+    ASSERT_THROWS(ret.connect([]() { return 1; },
+                              xswl::connect_options_t().budget(std::chrono::milliseconds(1))),
+                  std::invalid_argument);
+}
+
+// 测试：预算不能与排队或线程亲和组合，connect 抛出异常而不是静默忽略预算
+TEST_CASE(cost_budget_rejects_async_delivery)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    const auto budget = std::chrono::milliseconds(1);
+
+    ASSERT_THROWS(sig.connect([](int) {}, xswl::connect_options_t().queued(loop).budget(budget)),
+                  std::invalid_argument);
+    ASSERT_THROWS(sig.connect([](int) {}, xswl::connect_options_t().coalesced(loop).budget(budget)),
+                  std::invalid_argument);
+    ASSERT_THROWS(sig.connect([](int) {}, xswl::connect_options_t().thread_affine().budget(budget)),
+                  std::invalid_argument);
+    ASSERT_EQ(sig.slot_count(), 0u);
+
+    // 节流仍可与预算组合
+    auto conn = sig.connect([](int) {}, xswl::connect_options_t()
+                                            .throttle(std::chrono::milliseconds(10))
+                                            .budget(budget));
+    ASSERT_EQ(conn.cost().budget, std::chrono::nanoseconds(budget));
+}
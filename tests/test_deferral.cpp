@@ -0,0 +1,278 @@
+#include "test_common.hpp"
+
+// 测试：守卫存活期间发射被缓存，析构时按原顺序补发
+TEST_CASE(deferral_buffers_until_scope_exit)
+{
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+    sig.connect([&received](int v) { received.push_back(v); });
+
+    {
+        xswl::deferral_guard_t guard(sig);
+        sig(1);
+        sig(2);
+        sig(1);
+        ASSERT_TRUE(received.empty());
+    }
+
+    ASSERT_EQ(received.size(), 3u);
+    ASSERT_EQ(received[0], 1);
+    ASSERT_EQ(received[1], 2);
+    ASSERT_EQ(received[2], 1);
+
+    sig(3); // 守卫结束后恢复直接发射
+    ASSERT_EQ(received.size(), 4u);
+}
+
+// 测试：去重模式丢弃与任一已缓存参数相同的发射，按首次出现的顺序补发
+TEST_CASE(deferral_dedup)
+{
+    xswl::signal_t<int, std::string> sig;
+    std::vector<std::string> received;
+    sig.connect([&received](int v, const std::string &s) {
+        received.push_back(std::to_string(v) + s);
+    });
+
+    {
+        xswl::deferral_guard_t guard(xswl::dedup, sig);
+        for (int i = 0; i < 1000; ++i)
+            sig(i % 3, "x");
+        sig(1, "y");
+        sig(1, "y");
+        sig(2, "x");
+    }
+
+    ASSERT_EQ(received.size(), 4u);
+    ASSERT_EQ(received[0], "0x");
+    ASSERT_EQ(received[1], "1x");
+    ASSERT_EQ(received[2], "2x");
+    ASSERT_EQ(received[3], "1y");
+}
+
+// 测试：全量去重在补发时按哈希完成，大量交错的发射也能处理
+TEST_CASE(deferral_dedup_large_interleaved_burst)
+{
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+    sig.connect([&received](int v) { received.push_back(v); });
+
+    const int keys = 20000;
+    {
+        xswl::deferral_guard_t guard(xswl::dedup, sig);
+        for (int round = 0; round < 3; ++round)
+            for (int k = 0; k < keys; ++k)
+                sig(k);
+    }
+
+    ASSERT_EQ(received.size(), static_cast<std::size_t>(keys));
+    for (int k = 0; k < keys; ++k)
+        ASSERT_EQ(received[k], k);
+}
+
+namespace {
+struct unhashable_key
+{
+    int id;
+    bool operator==(const unhashable_key &other) const { return id == other.id; }
+};
+} // namespace
+
+// 测试：参数不支持 std::hash 时 dedup 退化为只合并连续的重复发射
+TEST_CASE(deferral_dedup_unhashable_falls_back_to_consecutive)
+{
+    xswl::signal_t<unhashable_key> sig;
+    std::vector<int> received;
+    sig.connect([&received](const unhashable_key &k) { received.push_back(k.id); });
+
+    {
+        xswl::deferral_guard_t guard(xswl::dedup, sig);
+        sig(unhashable_key{1});
+        sig(unhashable_key{1});
+        sig(unhashable_key{2});
+        sig(unhashable_key{1});
+    }
+
+    ASSERT_EQ(received.size(), 3u);
+    ASSERT_EQ(received[0], 1);
+    ASSERT_EQ(received[1], 2);
+    ASSERT_EQ(received[2], 1);
+}
+
+// 测试：连续去重只合并连续重复的发射，被隔开的相同参数各自补发
+TEST_CASE(deferral_dedup_consecutive)
+{
+    xswl::signal_t<int, std::string> sig;
+    std::vector<std::string> received;
+    sig.connect([&received](int v, const std::string &s) {
+        received.push_back(std::to_string(v) + s);
+    });
+
+    {
+        xswl::deferral_guard_t guard(xswl::dedup_consecutive, sig);
+        for (int i = 0; i < 1000; ++i)
+            sig(i / 250, "x");
+        sig(1, "y");
+        sig(1, "y");
+        sig(3, "x");
+    }
+
+    ASSERT_EQ(received.size(), 6u);
+    ASSERT_EQ(received[0], "0x");
+    ASSERT_EQ(received[1], "1x");
+    ASSERT_EQ(received[2], "2x");
+    ASSERT_EQ(received[3], "3x");
+    ASSERT_EQ(received[4], "1y");
+    ASSERT_EQ(received[5], "3x");
+}
+
+// 测试：延迟只作用于创建守卫的线程，其他线程的发射在自己的线程上同步交付
+TEST_CASE(deferral_other_threads_emit_synchronously)
+{
+    xswl::signal_t<int> sig;
+    std::mutex mutex;
+    std::vector<int> received;
+    std::vector<std::thread::id> threads;
+    sig.connect([&](int v) {
+        std::lock_guard<std::mutex> lk(mutex);
+        received.push_back(v);
+        threads.push_back(std::this_thread::get_id());
+    });
+
+    std::thread::id other_id;
+    {
+        xswl::deferral_guard_t guard(sig);
+        sig(1);
+        std::thread other([&sig] { sig(7); });
+        other_id = other.get_id();
+        other.join();
+
+        ASSERT_EQ(received.size(), 1u);
+        ASSERT_EQ(received[0], 7);
+        ASSERT_TRUE(threads[0] == other_id);
+    }
+
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[1], 1);
+    ASSERT_TRUE(threads[1] == std::this_thread::get_id());
+}
+
+// 测试：不同线程各自的守卫互不影响，各自补发自己缓存的发射
+TEST_CASE(deferral_guards_on_two_threads)
+{
+    xswl::signal_t<int> sig;
+    std::mutex mutex;
+    std::vector<int> received;
+    sig.connect([&](int v) {
+        std::lock_guard<std::mutex> lk(mutex);
+        received.push_back(v);
+    });
+
+    std::size_t seen = 0;
+    {
+        xswl::deferral_guard_t guard(sig);
+        sig(1);
+
+        std::thread([&] {
+            {
+                xswl::deferral_guard_t inner(sig);
+                sig(2);
+            }
+            std::lock_guard<std::mutex> lk(mutex);
+            seen = received.size();
+        }).join();
+
+        ASSERT_EQ(seen, 1u);
+        ASSERT_EQ(received[0], 2);
+    }
+
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[1], 1);
+}
+
+// 测试：一个守卫可以覆盖多个信号，按列出顺序逐个信号补发
+TEST_CASE(deferral_multiple_signals)
+{
+    xswl::signal_t<int> a;
+    xswl::signal_t<std::string> b;
+    std::vector<std::string> log;
+    a.connect([&log](int v) { log.push_back("a" + std::to_string(v)); });
+    b.connect([&log](const std::string &s) { log.push_back("b" + s); });
+
+    {
+        xswl::deferral_guard_t guard(a, b);
+        b("1");
+        a(1);
+        b("2");
+        a(2);
+    }
+
+    ASSERT_EQ(log.size(), 4u);
+    ASSERT_EQ(log[0], "a1");
+    ASSERT_EQ(log[1], "a2");
+    ASSERT_EQ(log[2], "b1");
+    ASSERT_EQ(log[3], "b2");
+}
+
+// 测试：嵌套守卫只在最外层结束时补发；补发期间槽内的发射直接交付
+TEST_CASE(deferral_nested_and_reentrant)
+{
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+    sig.connect([&](int v) {
+        received.push_back(v);
+        if (v == 1)
+            sig(100);
+    });
+
+    {
+        xswl::deferral_guard_t outer(sig);
+        {
+            xswl::deferral_guard_t inner(sig);
+            sig(1);
+        }
+        ASSERT_TRUE(received.empty());
+        sig(2);
+    }
+
+    ASSERT_EQ(received.size(), 3u);
+    ASSERT_EQ(received[0], 1);
+    ASSERT_EQ(received[1], 100);
+    ASSERT_EQ(received[2], 2);
+}
+
+// 测试：延迟发射与 wait 配合，补发时唤醒等待者
+TEST_CASE(deferral_flush_wakes_waiters)
+{
+    xswl::signal_t<int> sig;
+    std::tuple<int> args;
+    std::atomic<bool> woke{false};
+
+    std::thread waiter([&]() { woke.store(sig.wait_for(args, std::chrono::seconds(5))); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    {
+        xswl::deferral_guard_t guard(sig);
+        sig(9);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ASSERT_FALSE(woke.load());
+    }
+    waiter.join();
+
+    ASSERT_TRUE(woke.load());
+    ASSERT_EQ(std::get<0>(args), 9);
+}
+
+// 测试：不去重时参数类型无需支持 operator==
+TEST_CASE(deferral_non_comparable_args)
+{
+    xswl::signal_t<std::function<int()>> sig;
+    int total = 0;
+    sig.connect([&total](const std::function<int()> &fn) { total += fn(); });
+
+    {
+        xswl::deferral_guard_t guard(sig);
+        sig([]() { return 1; });
+        sig([]() { return 2; });
+    }
+    ASSERT_EQ(total, 3);
+}
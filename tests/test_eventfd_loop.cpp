@@ -0,0 +1,123 @@
+#include "test_common.hpp"
+
+#if defined(__linux__)
+
+#include <poll.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+// 非阻塞检查描述符是否可读
+static bool fd_readable(int fd, int timeout_ms = 0)
+{
+    struct pollfd p;
+    p.fd = fd;
+    p.events = POLLIN;
+    p.revents = 0;
+    return ::poll(&p, 1, timeout_ms) == 1 && (p.revents & POLLIN) != 0;
+}
+
+// 测试：投递后 fd 可读，drain 后恢复不可读
+TEST_CASE(eventfd_loop_readiness)
+{
+    auto loop = std::make_shared<xswl::eventfd_loop_t>();
+    ASSERT_GE(loop->fd(), 0);
+    ASSERT_FALSE(fd_readable(loop->fd()));
+
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+    sig.connect([&received](int v) { received.push_back(v); },
+                xswl::connect_options_t().queued(loop));
+
+    sig(1);
+    sig(2);
+    ASSERT_TRUE(fd_readable(loop->fd()));
+
+    ASSERT_EQ(loop->drain(), 1u);
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_FALSE(fd_readable(loop->fd()));
+}
+
+// 测试：drain 未执行完时 fd 保持可读
+TEST_CASE(eventfd_loop_partial_drain_rearms)
+{
+    xswl::eventfd_loop_t loop;
+    Counter counter;
+    for (int i = 0; i < 3; ++i)
+        loop.post([&counter]() { counter.increment(); });
+
+    ASSERT_EQ(loop.drain(2), 2u);
+    ASSERT_TRUE(fd_readable(loop.fd()));
+    ASSERT_EQ(loop.drain(), 1u);
+    ASSERT_FALSE(fd_readable(loop.fd()));
+    ASSERT_EQ(counter.get(), 3);
+}
+
+// 测试：作为 epoll reactor 的一个描述符，跨线程发射唤醒 epoll_wait
+TEST_CASE(eventfd_loop_epoll_reactor)
+{
+    auto loop = std::make_shared<xswl::eventfd_loop_t>();
+    xswl::signal_t<int> sig;
+    std::atomic<int> total{0};
+    sig.connect([&total](int v) { total.fetch_add(v); },
+                xswl::connect_options_t().queued(loop));
+
+    int ep = ::epoll_create1(EPOLL_CLOEXEC);
+    ASSERT_GE(ep, 0);
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.fd = loop->fd();
+    ASSERT_EQ(::epoll_ctl(ep, EPOLL_CTL_ADD, loop->fd(), &ev), 0);
+
+    const int n = 1000;
+    std::thread producer([&sig]() {
+        for (int i = 0; i < n; ++i)
+            sig(1);
+    });
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (total.load() < n && std::chrono::steady_clock::now() < deadline)
+    {
+        struct epoll_event out;
+        if (::epoll_wait(ep, &out, 1, 100) == 1)
+            loop->drain();
+    }
+    producer.join();
+    ::close(ep);
+
+    ASSERT_EQ(total.load(), n);
+}
+
+// 测试：与 drain 并发的跨线程投递不会丢失唤醒，有任务时 fd 一定可读
+TEST_CASE(eventfd_loop_concurrent_post_keeps_readiness)
+{
+    xswl::eventfd_loop_t loop;
+    std::atomic<int> ran{0};
+
+    for (int round = 0; round < 200; ++round)
+    {
+        std::atomic<bool> stop{false};
+        std::thread producer([&]() {
+            while (!stop.load())
+                loop.post([&ran]() { ran.fetch_add(1); });
+        });
+        for (int i = 0; i < 20; ++i)
+            loop.drain();
+        stop.store(true);
+        producer.join();
+
+        // 投递线程已结束：有任务就必须可读
+        if (!loop.empty())
+            ASSERT_TRUE(fd_readable(loop.fd()));
+        loop.drain();
+        ASSERT_TRUE(loop.empty());
+        ASSERT_FALSE(fd_readable(loop.fd()));
+
+        // 空闲后的第一次投递必须重新唤醒
+        loop.post([&ran]() { ran.fetch_add(1); });
+        ASSERT_TRUE(fd_readable(loop.fd()));
+        loop.drain();
+    }
+    ASSERT_GT(ran.load(), 0);
+}
+
+#endif
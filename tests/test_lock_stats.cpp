@@ -0,0 +1,62 @@
+// 本文件所在的测试程序以 XSWL_SIGNALS_LOCK_STATS 编译
+#include "test_common.hpp"
+
+// 测试：连接、发射、查询与断开都计入加锁次数；单线程时没有竞争
+TEST_CASE(lock_stats_counts_acquisitions)
+{
+    xswl::signal_t<int> sig;
+    sig.reset_lock_stats();
+    ASSERT_EQ(sig.lock_stats().acquisitions, 0u);
+
+    auto conn = sig.connect([](int) {});
+    std::uint64_t after_connect = sig.lock_stats().acquisitions;
+    ASSERT_GE(after_connect, 1u);
+
+    sig(1);
+    std::uint64_t after_emit = sig.lock_stats().acquisitions;
+    ASSERT_GT(after_emit, after_connect);
+
+    ASSERT_EQ(sig.slot_count(), 1u);
+    ASSERT_EQ(sig.lock_stats().acquisitions, after_emit + 1);
+
+    conn.disconnect();
+    ASSERT_EQ(sig.lock_stats().acquisitions, after_emit + 2);
+
+    xswl::lock_stats_t stats = sig.lock_stats();
+    ASSERT_EQ(stats.contended, 0u);
+    ASSERT_EQ(stats.wait.count(), 0);
+
+    sig.reset_lock_stats();
+    ASSERT_EQ(sig.lock_stats().acquisitions, 0u);
+}
+
+// 测试：多个线程同时连接、断开与发射时记录到竞争与等待时间
+TEST_CASE(lock_stats_records_contention)
+{
+    xswl::signal_t<> sig;
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&] {
+            while (!stop.load())
+            {
+                auto c = sig.connect([] {});
+                sig();
+                c.disconnect();
+                (void)sig.slot_count();
+            }
+        });
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (sig.lock_stats().contended == 0 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    stop.store(true);
+    for (auto &t : threads)
+        t.join();
+
+    xswl::lock_stats_t stats = sig.lock_stats();
+    ASSERT_GT(stats.contended, 0u);
+    ASSERT_LE(stats.contended, stats.acquisitions);
+    ASSERT_GT(stats.wait.count(), 0);
+    ASSERT_GE(stats.wait.count(), stats.max_wait.count());
+}
@@ -0,0 +1,90 @@
+#include "test_common.hpp"
+
+// 测试：空信号只计入共享状态本身，连接后各分项随槽增长，断开并清理后回落
+TEST_CASE(memory_usage_grows_and_shrinks)
+{
+    xswl::signal_t<int> sig;
+    xswl::memory_usage_t empty = sig.memory_usage();
+    ASSERT_GT(empty.signal, 0u);
+    ASSERT_EQ(empty.slots, 0u);
+    ASSERT_EQ(empty.slot_count, 0u);
+    ASSERT_EQ(empty.total(), empty.signal + empty.containers);
+
+    std::vector<xswl::connection_t<int>> conns;
+    for (int i = 0; i < 10; ++i)
+        conns.push_back(sig.connect([](int) {}));
+
+    xswl::memory_usage_t full = sig.memory_usage();
+    ASSERT_EQ(full.slot_count, 10u);
+    ASSERT_EQ(full.slots % 10, 0u);
+    ASSERT_GE(full.slots / 10, sizeof(int));
+    ASSERT_GE(full.containers, 10 * sizeof(void *));
+    ASSERT_GT(full.total(), empty.total());
+
+    for (auto &c : conns)
+        c.disconnect();
+    ASSERT_EQ(sig.memory_usage().slot_count, 10u); // 等待下一次发射清理
+    sig(0);
+    ASSERT_EQ(sig.memory_usage().slot_count, 0u);
+    ASSERT_EQ(sig.memory_usage().slots, 0u);
+}
+
+// 测试：较大的捕获计入 captures，函数指针与小的平凡捕获不计入
+TEST_CASE(memory_usage_captures)
+{
+    xswl::signal_t<int> sig;
+    int value = 0;
+    sig.connect([&value](int v) { value = v; });
+    ASSERT_EQ(sig.memory_usage().captures, 0u);
+
+    long payload[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    auto big = sig.connect([payload, &value](int v) { value = static_cast<int>(payload[v & 7]); });
+    xswl::memory_usage_t usage = sig.memory_usage();
+    ASSERT_GE(usage.captures, sizeof(payload));
+
+    std::size_t before = big.memory_usage();
+    ASSERT_GE(before, usage.captures);
+    big.disconnect();
+    ASSERT_EQ(big.memory_usage(), 0u);
+}
+
+// 测试：标签名超出短字符串缓冲区时计入堆占用，按标签断开后不再计入
+TEST_CASE(memory_usage_tags)
+{
+    xswl::signal_t<> sig;
+    sig.connect("short", []() {});
+    std::size_t short_tag = sig.memory_usage().tags;
+    ASSERT_GT(short_tag, 0u);
+
+    const std::string long_name(200, 'x');
+    sig.connect(long_name, []() {});
+    ASSERT_GE(sig.memory_usage().tags, 2 * short_tag + 200);
+
+    ASSERT_TRUE(sig.disconnect(long_name));
+    ASSERT_EQ(sig.memory_usage().tags, short_tag);
+}
+
+// 测试：排队连接的投递策略与积压参数计入 dispatchers
+TEST_CASE(memory_usage_dispatchers)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<std::string> sig;
+    sig.connect([](const std::string &) {});
+    ASSERT_EQ(sig.memory_usage().dispatchers, 0u);
+
+    auto conn = sig.connect([](const std::string &) {}, xswl::connect_options_t().queued(loop));
+    std::size_t idle = sig.memory_usage().dispatchers;
+    ASSERT_GT(idle, 0u);
+
+    for (int i = 0; i < 5; ++i)
+        sig("pending");
+    ASSERT_GE(sig.memory_usage().dispatchers, idle + 5 * sizeof(std::string));
+
+    loop->drain();
+    ASSERT_EQ(sig.memory_usage().dispatchers, idle);
+
+    auto limited = sig.connect([](const std::string &) {},
+                               xswl::connect_options_t().throttle(std::chrono::seconds(1)));
+    ASSERT_GT(limited.memory_usage(), 0u);
+    ASSERT_GT(sig.memory_usage().dispatchers, idle);
+}
@@ -0,0 +1,189 @@
+// 本文件所在的测试程序以 XSWL_SIGNALS_DEBUG_NO_ALLOC 编译，并替换全局 operator new
+#include "test_common.hpp"
+
+XSWL_SIGNALS_DEFINE_CHECKED_NEW()
+
+static std::atomic<int> g_violations{0};
+static std::atomic<std::size_t> g_violation_bytes{0};
+
+static void count_violation(std::size_t bytes)
+{
+    g_violations.fetch_add(1);
+    g_violation_bytes.fetch_add(bytes);
+}
+
+// 安装计数处理函数，析构时恢复默认处理（abort）
+struct violation_counter
+{
+    violation_counter()
+    {
+        g_violations.store(0);
+        g_violation_bytes.store(0);
+        xswl::set_emit_alloc_handler(count_violation);
+    }
+    ~violation_counter() { xswl::set_emit_alloc_handler(nullptr); }
+    int count() const { return g_violations.load(); }
+};
+
+// 测试：处理函数能捕获稳态区域内的分配
+TEST_CASE(no_alloc_handler_reports_violation)
+{
+    violation_counter counter;
+    {
+        xswl::detail::no_alloc_scope scope;
+        std::unique_ptr<int> p(new int(1));
+    }
+    ASSERT_EQ(counter.count(), 1);
+    ASSERT_GE(g_violation_bytes.load(), sizeof(int));
+
+    std::unique_ptr<int> outside(new int(2)); // 区域外分配不报告
+    ASSERT_EQ(counter.count(), 1);
+}
+
+// 测试：快照就绪后，同步槽（lambda、跟踪成员、标签、不同优先级）的发射不分配
+TEST_CASE(no_alloc_steady_state_emit)
+{
+    violation_counter counter;
+    auto receiver = std::make_shared<Receiver>();
+    xswl::signal_t<int> sig;
+    int total = 0;
+
+    sig.connect([&total](int v) { total += v; }, 10);
+    sig.connect(receiver, &Receiver::on_value);
+    sig.connect("tag", [&total](int v) { total -= v; }, -5);
+    sig.connect([&total]() { ++total; });
+
+    sig(1); // 槽表变化后的首次发射重建快照，允许分配
+    for (int i = 0; i < 1000; ++i)
+        sig(i);
+
+    ASSERT_EQ(counter.count(), 0);
+    ASSERT_EQ(receiver->call_count(), 1001);
+}
+
+// 测试：开启采样剖析后，被采样的发射在信号汇总创建之后同样不分配
+TEST_CASE(no_alloc_sampled_emit)
+{
+    violation_counter counter;
+    xswl::signal_t<int> sig;
+    int total = 0;
+    sig.connect([&total](int v) { total += v; });
+    sig.connect([&total](int v) { total -= v; });
+
+    xswl::profiler::start(1);
+    sig(1); // 首次采样创建汇总，允许分配
+    for (int i = 0; i < 1000; ++i)
+        sig(i);
+    xswl::profiler::stop();
+
+    ASSERT_EQ(counter.count(), 0);
+    ASSERT_EQ(total, 0);
+}
+
+// 测试：槽函数自身的分配不算违反
+TEST_CASE(no_alloc_slot_may_allocate)
+{
+    violation_counter counter;
+    xswl::signal_t<int> sig;
+    std::size_t sizes = 0;
+    sig.connect([&sizes](int n) {
+        std::vector<int> scratch(static_cast<std::size_t>(n));
+        sizes += scratch.size();
+    });
+
+    for (int i = 1; i <= 100; ++i)
+        sig(i);
+
+    ASSERT_EQ(counter.count(), 0);
+    ASSERT_EQ(sizes, 5050u);
+}
+
+// 测试：按值传入的参数拷贝在稳态区域之外
+TEST_CASE(no_alloc_string_argument)
+{
+    violation_counter counter;
+    xswl::signal_t<std::string> sig;
+    std::size_t length = 0;
+    sig.connect([&length](const std::string &s) { length += s.size(); });
+
+    const std::string payload(256, 'x');
+    for (int i = 0; i < 100; ++i)
+        sig(payload);
+
+    ASSERT_EQ(counter.count(), 0);
+    ASSERT_EQ(length, 25600u);
+}
+
+// 测试：连接、断开、单次槽与跟踪对象过期都只在下一次发射时重建快照
+TEST_CASE(no_alloc_rebuild_after_changes)
+{
+    violation_counter counter;
+    xswl::signal_t<int> sig;
+    Counter calls;
+
+    sig.connect([&calls](int) { calls.increment(); });
+    sig(0);
+
+    auto extra = sig.connect([&calls](int) { calls.increment(); });
+    sig(0);
+    sig(0);
+    extra.disconnect();
+    sig(0);
+
+    sig.connect_once([&calls](int) { calls.increment(); });
+    sig(0);
+    sig(0);
+
+    {
+        auto receiver = std::make_shared<Receiver>();
+        sig.connect(receiver, &Receiver::on_value);
+        sig(0);
+    }
+    sig(0); // 发现过期，标记清理
+    sig(0);
+
+    ASSERT_EQ(counter.count(), 0);
+    ASSERT_EQ(calls.get(), 1 + 2 + 2 + 1 + 2 + 1 + 1 + 1 + 1);
+    ASSERT_EQ(sig.slot_count(), 1u);
+}
+
+// 测试：返回值信号的合并发射同样不分配
+TEST_CASE(no_alloc_combine)
+{
+    violation_counter counter;
+    xswl::signal_t<int(int)> sig;
+    sig.connect([](int v) { return v; });
+    sig.connect([](int v) { return v * 2; });
+
+    ASSERT_EQ(sig.combine(xswl::sum_t<int>(), 1), 3);
+    int total = 0;
+    for (int i = 0; i < 100; ++i)
+        total += sig.combine(xswl::sum_t<int>(), i);
+
+    ASSERT_EQ(counter.count(), 0);
+    ASSERT_EQ(total, 3 * 4950);
+}
+
+// 测试：多线程并发稳态发射不分配
+TEST_CASE(no_alloc_concurrent_emit)
+{
+    violation_counter counter;
+    xswl::signal_t<int> sig;
+    std::atomic<int> total{0};
+    sig.connect([&total](int v) { total.fetch_add(v); });
+    sig(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&sig]() {
+            for (int i = 0; i < 1000; ++i)
+                sig(1);
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+
+    ASSERT_EQ(counter.count(), 0);
+    ASSERT_EQ(total.load(), 4000);
+}
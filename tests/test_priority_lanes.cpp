@@ -0,0 +1,160 @@
+#include "test_common.hpp"
+
+// 测试：同一事件循环上，高优先级排队连接先于低优先级交付
+TEST_CASE(priority_lanes_order_queued_connections)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> data;
+    xswl::signal_t<int> control;
+    std::vector<std::string> log;
+
+    data.connect([&log](int v) { log.push_back("data" + std::to_string(v)); },
+                 xswl::connect_options_t(0).queued(loop));
+    control.connect([&log](int v) { log.push_back("control" + std::to_string(v)); },
+                    xswl::connect_options_t(10).queued(loop));
+
+    data(1);
+    control(1);
+
+    loop->drain();
+    ASSERT_EQ(log.size(), 2u);
+    ASSERT_EQ(log[0], "control1");
+    ASSERT_EQ(log[1], "data1");
+}
+
+// 测试：同一优先级内保持提交顺序
+TEST_CASE(priority_lanes_fifo_within_lane)
+{
+    xswl::event_loop_t loop;
+    std::vector<int> order;
+    for (int i = 0; i < 5; ++i)
+        loop.post([&order, i]() { order.push_back(i); });
+    loop.post_prioritized([&order]() { order.push_back(100); }, 1);
+
+    loop.drain();
+    ASSERT_EQ(order.size(), 6u);
+    ASSERT_EQ(order[0], 100);
+    for (int i = 0; i < 5; ++i)
+        ASSERT_EQ(order[i + 1], i);
+}
+
+// 测试：老化保证低优先级任务在持续的高优先级洪流中仍能执行
+TEST_CASE(priority_lanes_aging_prevents_starvation)
+{
+    xswl::event_loop_t loop(4);
+    std::vector<int> order;
+
+    loop.post_prioritized([&order]() { order.push_back(-1); }, -5);
+    for (int i = 0; i < 20; ++i)
+        loop.post_prioritized([&order, i]() { order.push_back(i); }, 5);
+
+    loop.drain();
+    ASSERT_EQ(order.size(), 21u);
+    // 低优先级任务被跳过 4 次后先执行一次
+    ASSERT_EQ(order[4], -1);
+}
+
+// 测试：aging 为 0 时严格按优先级执行
+TEST_CASE(priority_lanes_strict_without_aging)
+{
+    xswl::event_loop_t loop(0);
+    std::vector<int> order;
+
+    loop.post_prioritized([&order]() { order.push_back(-1); }, -5);
+    for (int i = 0; i < 20; ++i)
+        loop.post_prioritized([&order, i]() { order.push_back(i); }, 5);
+
+    loop.drain();
+    ASSERT_EQ(order.back(), -1);
+}
+
+// 测试：drain 期间投递的高优先级任务不会插入本次 drain
+TEST_CASE(priority_lanes_drain_boundary)
+{
+    xswl::event_loop_t loop;
+    std::vector<int> order;
+
+    loop.post([&]() {
+        order.push_back(1);
+        loop.post_prioritized([&order]() { order.push_back(100); }, 10);
+    });
+    loop.post([&order]() { order.push_back(2); });
+
+    ASSERT_EQ(loop.drain(), 2u);
+    ASSERT_EQ(order.size(), 2u);
+    ASSERT_EQ(order[1], 2);
+    ASSERT_EQ(loop.pending(), 1u);
+
+    loop.drain();
+    ASSERT_EQ(order[2], 100);
+}
+
+// 测试：一次 drain 交付排队连接在调用时的全部积压，即使超过单个交付任务的批量
+TEST_CASE(priority_lanes_single_drain_delivers_backlog)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> bulk;
+    std::vector<int> received;
+
+    bulk.connect([&received](int v) { received.push_back(v); },
+                 xswl::connect_options_t(-5).queued(loop));
+
+    const int n = 1000;
+    for (int i = 0; i < n; ++i)
+        bulk(i);
+
+    ASSERT_EQ(loop->drain(), 1u); // 续作不计入执行数量
+    ASSERT_EQ(received.size(), static_cast<std::size_t>(n));
+    for (int i = 0; i < n; ++i)
+        ASSERT_EQ(received[i], i);
+    ASSERT_TRUE(loop->empty());
+}
+
+// 测试：大量积压分批交付，批次之间同车道中已排队的任务可以先执行
+TEST_CASE(priority_lanes_backlog_yields_between_batches)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> bulk;
+    xswl::signal_t<int> other;
+    std::vector<int> received;
+    std::size_t other_at = 0;
+
+    bulk.connect([&received](int v) { received.push_back(v); },
+                 xswl::connect_options_t().queued(loop));
+    other.connect([&](int) { other_at = received.size(); },
+                  xswl::connect_options_t().queued(loop));
+
+    const int n = 1000;
+    for (int i = 0; i < n; ++i)
+        bulk(i);
+    other(0);
+
+    loop->drain();
+    ASSERT_EQ(received.size(), static_cast<std::size_t>(n));
+    ASSERT_GT(other_at, 0u);
+    ASSERT_LT(other_at, static_cast<std::size_t>(n));
+}
+
+// 测试：槽在交付中重入发射的参数留到下一次 drain，drain 不会无限延长
+TEST_CASE(priority_lanes_reentrant_emit_waits_for_next_drain)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+
+    sig.connect([&](int v) {
+        received.push_back(v);
+        sig(v + 1);
+    }, xswl::connect_options_t().queued(loop));
+
+    for (int i = 0; i < 100; ++i)
+        sig(i * 1000);
+
+    loop->drain();
+    ASSERT_EQ(received.size(), 100u);
+    ASSERT_FALSE(loop->empty());
+
+    loop->drain();
+    ASSERT_EQ(received.size(), 200u);
+    ASSERT_EQ(received[100], 1);
+}
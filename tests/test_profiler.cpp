@@ -0,0 +1,179 @@
+#include "test_common.hpp"
+
+static const xswl::emit_profile_t *find_profile(const std::vector<xswl::emit_profile_t> &profiles,
+                                                const std::string &name)
+{
+    for (const auto &p : profiles)
+        if (p.name == name)
+            return &p;
+    return nullptr;
+}
+
+// 每个测试开始前清零汇总，结束时停止采样
+struct profiler_session
+{
+    explicit profiler_session(std::uint32_t every_n)
+    {
+        xswl::profiler::reset();
+        xswl::profiler::start(every_n);
+    }
+    ~profiler_session() { xswl::profiler::stop(); }
+};
+
+// 测试：默认关闭，发射不产生汇总
+TEST_CASE(profiler_off_by_default)
+{
+    ASSERT_FALSE(xswl::profiler::active());
+    xswl::signal_t<> sig;
+    sig.set_name("profiler_off_by_default");
+    sig.connect([] {});
+    for (int i = 0; i < 5000; ++i)
+        sig();
+    ASSERT_TRUE(find_profile(xswl::profiler::snapshot(), "profiler_off_by_default") == nullptr);
+}
+
+// 测试：每次都采样时，扇出、发射耗时与最慢的槽均被记录
+TEST_CASE(profiler_records_fanout_and_slowest_slot)
+{
+    xswl::signal_t<int> sig;
+    sig.set_name("profiler_records_fanout_and_slowest_slot");
+    sig.connect([](int) {});
+    auto slow = sig.connect([](int ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    });
+    auto blocked = sig.connect([](int) {});
+    blocked.block();
+
+    profiler_session session(1);
+    for (int i = 0; i < 5; ++i)
+        sig(i == 2 ? 2 : 0);
+
+    auto profiles = xswl::profiler::snapshot();
+    const xswl::emit_profile_t *p = find_profile(profiles, "profiler_records_fanout_and_slowest_slot");
+    ASSERT_TRUE(p != nullptr);
+    ASSERT_EQ(p->samples, 5u);
+    ASSERT_EQ(p->estimated_emissions, 5u);
+    ASSERT_EQ(p->max_fanout, 2u); // 被阻塞的槽不计入
+    ASSERT_TRUE(p->mean_fanout > 1.99 && p->mean_fanout < 2.01);
+    ASSERT_GE(p->max_duration.count(), std::chrono::nanoseconds(std::chrono::milliseconds(2)).count());
+    ASSERT_GE(p->slowest_slot_duration.count(),
+              std::chrono::nanoseconds(std::chrono::milliseconds(2)).count());
+    ASSERT_LE(p->mean_duration.count(), p->max_duration.count());
+    ASSERT_TRUE(p->slowest_slot != nullptr);
+
+    xswl::profiler::reset();
+    ASSERT_TRUE(find_profile(xswl::profiler::snapshot(), "profiler_records_fanout_and_slowest_slot") == nullptr);
+}
+
+// 测试：1/N 采样的次数接近 发射数 / N
+TEST_CASE(profiler_samples_one_in_n)
+{
+    xswl::signal_t<> sig;
+    sig.set_name("profiler_samples_one_in_n");
+    sig.connect([] {});
+
+    profiler_session session(100);
+    for (int i = 0; i < 20000; ++i)
+        sig();
+
+    std::vector<xswl::emit_profile_t> profiles = xswl::profiler::snapshot();
+    const xswl::emit_profile_t *p = find_profile(profiles, "profiler_samples_one_in_n");
+    ASSERT_TRUE(p != nullptr);
+    ASSERT_GE(p->samples, 100u);
+    ASSERT_LE(p->samples, 400u);
+    ASSERT_EQ(p->estimated_emissions, p->samples * 100);
+}
+
+// 测试：停止后再取快照，估算仍按采样时的周期计算，之后改变周期不影响已有样本
+TEST_CASE(profiler_estimate_uses_sampling_period)
+{
+    xswl::signal_t<> sig;
+    sig.set_name("profiler_estimate_uses_sampling_period");
+    sig.connect([] {});
+
+    xswl::profiler::reset();
+    xswl::profiler::start(50);
+    for (int i = 0; i < 10000; ++i)
+        sig();
+    xswl::profiler::stop();
+
+    std::vector<xswl::emit_profile_t> profiles = xswl::profiler::snapshot();
+    const xswl::emit_profile_t *p = find_profile(profiles, "profiler_estimate_uses_sampling_period");
+    ASSERT_TRUE(p != nullptr);
+    std::uint64_t samples = p->samples;
+    ASSERT_GT(samples, 0u);
+    ASSERT_EQ(p->estimated_emissions, samples * 50);
+
+    xswl::profiler::start(7);
+    profiles = xswl::profiler::snapshot();
+    p        = find_profile(profiles, "profiler_estimate_uses_sampling_period");
+    ASSERT_TRUE(p != nullptr);
+    ASSERT_EQ(p->estimated_emissions, samples * 50);
+
+    sig();
+    xswl::profiler::stop();
+    profiles = xswl::profiler::snapshot();
+    p        = find_profile(profiles, "profiler_estimate_uses_sampling_period");
+    ASSERT_TRUE(p != nullptr);
+    ASSERT_EQ(p->samples, samples + 1);
+    ASSERT_EQ(p->estimated_emissions, samples * 50 + 7);
+}
+
+// 测试：没有槽的发射同样被采样，按扇出 0 记录
+TEST_CASE(profiler_records_empty_emissions)
+{
+    xswl::signal_t<int> sig;
+    sig.set_name("profiler_records_empty_emissions");
+
+    profiler_session session(1);
+    for (int i = 0; i < 4; ++i)
+        sig(i);
+    sig.connect([](int) {});
+    sig(4);
+
+    std::vector<xswl::emit_profile_t> profiles = xswl::profiler::snapshot();
+    const xswl::emit_profile_t *p = find_profile(profiles, "profiler_records_empty_emissions");
+    ASSERT_TRUE(p != nullptr);
+    ASSERT_EQ(p->samples, 5u);
+    ASSERT_EQ(p->estimated_emissions, 5u);
+    ASSERT_EQ(p->max_fanout, 1u);
+    ASSERT_TRUE(p->mean_fanout > 0.19 && p->mean_fanout < 0.21);
+}
+
+// 测试：其他线程的发射同样被采样，信号销毁后不再出现在汇总中
+TEST_CASE(profiler_other_threads_and_lifetime)
+{
+    profiler_session session(1);
+    {
+        xswl::signal_t<> sig;
+        sig.set_name("profiler_other_threads_and_lifetime");
+        sig.connect([] {});
+        std::thread worker([&sig] {
+            for (int i = 0; i < 3000; ++i)
+                sig();
+        });
+        worker.join();
+
+        std::vector<xswl::emit_profile_t> profiles = xswl::profiler::snapshot();
+        const xswl::emit_profile_t *p = find_profile(profiles, "profiler_other_threads_and_lifetime");
+        ASSERT_TRUE(p != nullptr);
+        ASSERT_GE(p->samples, 3000u - 1024u);
+    }
+    ASSERT_TRUE(find_profile(xswl::profiler::snapshot(), "profiler_other_threads_and_lifetime") == nullptr);
+}
+
+// 测试：反复创建并销毁被采样的信号，即使从不取快照，登记表也不会无限增长
+TEST_CASE(profiler_registry_prunes_destroyed_signals)
+{
+    profiler_session session(1);
+    for (int i = 0; i < 1000; ++i)
+    {
+        xswl::signal_t<> sig;
+        sig.connect([] {});
+        sig();
+    }
+
+    xswl::profiler::detail::registry &r = xswl::profiler::detail::registry::instance();
+    std::lock_guard<std::mutex> lk(r.mutex);
+    ASSERT_LE(r.blocks.size(), 128u);
+}
@@ -0,0 +1,107 @@
+#include "test_common.hpp"
+
+// 测试：高优先级槽停止传播后，低优先级槽在本次发射中不再被调用
+TEST_CASE(stop_propagation_skips_lower_priority)
+{
+    xswl::signal_t<int> sig;
+    std::vector<int> order;
+
+    sig.connect([&order](int v) {
+        order.push_back(100);
+        if (v == 1)
+            xswl::stop_propagation();
+    }, 100);
+    sig.connect([&order](int) { order.push_back(50); }, 50);
+    sig.connect([&order](int) { order.push_back(0); }, 0);
+
+    sig(1);
+    ASSERT_EQ(order.size(), 1u);
+    ASSERT_EQ(order[0], 100);
+
+    // 下一次发射重新从头开始
+    order.clear();
+    sig(2);
+    ASSERT_EQ(order.size(), 3u);
+}
+
+// 测试：中间优先级的槽认领事件
+TEST_CASE(stop_propagation_claims_event)
+{
+    xswl::signal_t<const std::string &> route;
+    std::string handled_by;
+
+    route.connect([&](const std::string &key) {
+        if (key == "ui") { handled_by = "ui"; xswl::stop_propagation(); }
+    }, 10);
+    route.connect([&](const std::string &key) {
+        if (key == "game") { handled_by = "game"; xswl::stop_propagation(); }
+    }, 5);
+    route.connect([&](const std::string &) { handled_by = "fallback"; }, 0);
+
+    route("game");
+    ASSERT_EQ(handled_by, "game");
+    route("ui");
+    ASSERT_EQ(handled_by, "ui");
+    route("other");
+    ASSERT_EQ(handled_by, "fallback");
+}
+
+// 测试：嵌套发射中的停止只影响内层发射
+TEST_CASE(stop_propagation_nested_emission)
+{
+    xswl::signal_t<> outer;
+    xswl::signal_t<> inner;
+    Counter outer_low, inner_low;
+
+    inner.connect([]() { xswl::stop_propagation(); }, 10);
+    inner.connect([&inner_low]() { inner_low.increment(); }, 0);
+
+    outer.connect([&inner]() { inner(); }, 10);
+    outer.connect([&outer_low]() { outer_low.increment(); }, 0);
+
+    outer();
+    ASSERT_EQ(inner_low.get(), 0);
+    ASSERT_EQ(outer_low.get(), 1);
+}
+
+// 测试：返回值信号同样支持停止传播，合并器只看到已调用槽的结果
+TEST_CASE(stop_propagation_return_signal)
+{
+    xswl::signal_t<int()> sig;
+    sig.connect([]() { return 1; }, 3);
+    sig.connect([]() { xswl::stop_propagation(); return 2; }, 2);
+    sig.connect([]() { return 4; }, 1);
+
+    ASSERT_EQ(sig.combine(xswl::sum_t<int>()), 3);
+    ASSERT_EQ(sig(), 2);
+}
+
+// 测试：在发射之外调用不影响后续发射
+TEST_CASE(stop_propagation_outside_emission)
+{
+    xswl::signal_t<> sig;
+    Counter counter;
+    sig.connect([&counter]() { counter.increment(); });
+    sig.connect([&counter]() { counter.increment(); });
+
+    xswl::stop_propagation();
+    sig();
+    ASSERT_EQ(counter.get(), 2);
+}
+
+// 测试：排队交付中的 stop_propagation() 只作用于本次交付，不会让正在 drain 的外层发射停止
+TEST_CASE(stop_propagation_queued_delivery_isolated)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> queued;
+    xswl::signal_t<> outer;
+    int later = 0;
+
+    queued.connect([](int) { xswl::stop_propagation(); }, xswl::connect_options_t().queued(loop));
+    outer.connect([&loop] { loop->drain(); }, 10);
+    outer.connect([&later] { ++later; }, 0);
+
+    queued(1);
+    outer();
+    ASSERT_EQ(later, 1);
+}
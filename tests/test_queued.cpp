@@ -0,0 +1,163 @@
+#include "test_common.hpp"
+
+// 测试：排队连接在发射时不调用槽，drain 时按发射顺序交付
+TEST_CASE(queued_connection_delivers_on_drain)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    std::vector<int> received;
+
+    sig.connect([&received](int v) { received.push_back(v); },
+                xswl::connect_options_t().queued(loop));
+
+    sig(1);
+    sig(2);
+    sig(3);
+    ASSERT_TRUE(received.empty());
+    ASSERT_EQ(loop->pending(), 1u); // 同一连接只占用一个交付任务
+
+    ASSERT_EQ(loop->drain(), 1u);
+    ASSERT_EQ(received.size(), 3u);
+    ASSERT_EQ(received[0], 1);
+    ASSERT_EQ(received[2], 3);
+    ASSERT_TRUE(loop->empty());
+}
+
+// 测试：合并连接只保留最新参数，每次 drain 至多调用一次
+TEST_CASE(coalesced_connection_keeps_latest)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int, std::string> sig;
+    int calls = 0;
+    int last = 0;
+    std::string last_str;
+
+    sig.connect([&](int v, const std::string &s) {
+        ++calls;
+        last = v;
+        last_str = s;
+    }, xswl::connect_options_t().coalesced(loop));
+
+    for (int i = 0; i < 1000; ++i)
+        sig(i, std::to_string(i));
+
+    ASSERT_EQ(loop->pending(), 1u);
+    loop->drain();
+    ASSERT_EQ(calls, 1);
+    ASSERT_EQ(last, 999);
+    ASSERT_EQ(last_str, "999");
+
+    // 无新发射时 drain 不再调用
+    ASSERT_EQ(loop->drain(), 0u);
+    ASSERT_EQ(calls, 1);
+
+    sig(5, "5");
+    loop->drain();
+    ASSERT_EQ(calls, 2);
+    ASSERT_EQ(last, 5);
+}
+
+// 测试：同一信号上直接连接与排队连接混用，直接连接不受影响
+TEST_CASE(queued_and_direct_mixed)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    Counter direct, queued;
+
+    sig.connect([&direct](int) { direct.increment(); }, 10);
+    sig.connect([&queued](int) { queued.increment(); },
+                xswl::connect_options_t(5).coalesced(loop));
+
+    sig(1);
+    sig(2);
+    ASSERT_EQ(direct.get(), 2);
+    ASSERT_EQ(queued.get(), 0);
+
+    loop->drain();
+    ASSERT_EQ(queued.get(), 1);
+}
+
+// 测试：交付前断开连接，积压的发射被丢弃
+TEST_CASE(queued_disconnect_before_drain)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    Counter counter;
+
+    auto conn = sig.connect([&counter](int) { counter.increment(); },
+                            xswl::connect_options_t().queued(loop));
+    sig(1);
+    conn.disconnect();
+    loop->drain();
+    ASSERT_EQ(counter.get(), 0);
+}
+
+// 测试：单次排队连接只交付一次，且在首次发射后即断开
+TEST_CASE(queued_connect_once)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    int value = 0;
+    Counter counter;
+
+    auto conn = sig.connect_once([&](int v) { counter.increment(); value = v; },
+                                 xswl::connect_options_t().queued(loop));
+    sig(7);
+    sig(8);
+    ASSERT_FALSE(conn.is_connected());
+
+    loop->drain();
+    ASSERT_EQ(counter.get(), 1);
+    ASSERT_EQ(value, 7);
+}
+
+// 测试：单次排队连接在交付前被显式断开，挂起的这一次交付被取消
+TEST_CASE(queued_connect_once_disconnect_before_drain)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    Counter counter;
+
+    auto conn = sig.connect_once([&counter](int) { counter.increment(); },
+                                 xswl::connect_options_t().queued(loop));
+    sig(7);
+    conn.disconnect();
+    loop->drain();
+    ASSERT_EQ(counter.get(), 0);
+}
+
+// 测试：执行器销毁后发射不再排队，也不会崩溃
+TEST_CASE(queued_executor_destroyed)
+{
+    xswl::signal_t<int> sig;
+    Counter counter;
+    {
+        auto loop = std::make_shared<xswl::event_loop_t>();
+        sig.connect([&counter](int) { counter.increment(); },
+                    xswl::connect_options_t().queued(loop));
+        sig(1);
+    }
+    sig(2);
+    ASSERT_EQ(counter.get(), 0);
+}
+
+// 测试：跨线程发射，消费线程 drain 后收到最新值
+TEST_CASE(coalesced_cross_thread)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    std::atomic<int> last{-1};
+
+    sig.connect([&last](int v) { last.store(v); },
+                xswl::connect_options_t().coalesced(loop));
+
+    std::thread producer([&sig]() {
+        for (int i = 0; i <= 10000; ++i)
+            sig(i);
+    });
+    producer.join();
+
+    ASSERT_LE(loop->pending(), 1u);
+    loop->drain();
+    ASSERT_EQ(last.load(), 10000);
+}
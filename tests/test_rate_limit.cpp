@@ -0,0 +1,208 @@
+#include "test_common.hpp"
+
+// 轮询等待条件成立，超时返回 false
+template <typename Pred>
+static bool wait_until_true(Pred pred, int timeout_ms = 2000)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (!pred())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+// 测试：节流连接在间隔内只调用一次（前沿触发），间隔过后恢复
+TEST_CASE(throttle_limits_rate)
+{
+    xswl::signal_t<int> sig;
+    Counter counter;
+    int first = -1;
+
+    sig.connect([&](int v) {
+        if (counter.get() == 0)
+            first = v;
+        counter.increment();
+    }, xswl::connect_options_t().throttle(std::chrono::milliseconds(200)));
+
+    for (int i = 0; i < 1000; ++i)
+        sig(i);
+    ASSERT_EQ(counter.get(), 1);
+    ASSERT_EQ(first, 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    sig(1);
+    ASSERT_EQ(counter.get(), 2);
+}
+
+// 测试：多线程同时发射，节流周期内仍只有一次调用
+TEST_CASE(throttle_concurrent_emitters)
+{
+    xswl::signal_t<> sig;
+    Counter counter;
+    sig.connect([&counter]() { counter.increment(); },
+                xswl::connect_options_t().throttle(std::chrono::seconds(10)));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&sig]() {
+            for (int i = 0; i < 1000; ++i)
+                sig();
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+
+    ASSERT_EQ(counter.get(), 1);
+}
+
+// 测试：防抖连接在安静期结束后只以最新参数调用一次
+TEST_CASE(debounce_fires_after_quiet_period)
+{
+    xswl::signal_t<int> sig;
+    std::atomic<int> calls{0};
+    std::atomic<int> last{-1};
+
+    sig.connect([&](int v) {
+        last.store(v);
+        calls.fetch_add(1);
+    }, xswl::connect_options_t().debounce(std::chrono::milliseconds(30)));
+
+    // 测试线程被长时间挂起时，发射之间可能出现完整的安静期，此时中途触发是正确行为
+    typedef std::chrono::steady_clock clock;
+    clock::duration longest_gap = clock::duration::zero();
+    clock::time_point prev      = clock::now();
+    for (int i = 0; i < 10; ++i)
+    {
+        sig(i);
+        const clock::time_point now = clock::now();
+        longest_gap = (std::max)(longest_gap, now - prev);
+        prev        = now;
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    const int early_calls  = calls.load(); // 先读计数再量时间，两者之间的挂起只会让判断更保守
+    const bool stayed_busy = (std::max)(longest_gap, clock::now() - prev) <
+                             std::chrono::milliseconds(30);
+    if (stayed_busy)
+        ASSERT_EQ(early_calls, 0);
+
+    ASSERT_TRUE(wait_until_true([&]() { return last.load() == 9; }));
+
+    // 再等一个周期，确认没有多余的调用
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    if (stayed_busy)
+        ASSERT_EQ(calls.load(), 1);
+    ASSERT_EQ(last.load(), 9);
+}
+
+// 测试：无参数防抖走无锁快路径，多线程连发后只调用一次，之后的发射重新计时
+TEST_CASE(debounce_concurrent_bursts_without_args)
+{
+    xswl::signal_t<> sig;
+    std::atomic<int> calls{0};
+    sig.connect([&calls]() { calls.fetch_add(1); },
+                xswl::connect_options_t().debounce(std::chrono::milliseconds(20)));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&sig] {
+            for (int i = 0; i < 1000; ++i)
+                sig();
+        });
+    for (auto &t : threads)
+        t.join();
+
+    ASSERT_TRUE(wait_until_true([&]() { return calls.load() == 1; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    ASSERT_EQ(calls.load(), 1);
+
+    sig();
+    ASSERT_TRUE(wait_until_true([&]() { return calls.load() == 2; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    ASSERT_EQ(calls.load(), 2);
+}
+
+// 测试：防抖 + 排队，安静期结束后交付到事件循环
+TEST_CASE(debounce_with_queued_delivery)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    int last = -1;
+
+    sig.connect([&last](int v) { last = v; },
+                xswl::connect_options_t().queued(loop).debounce(std::chrono::milliseconds(10)));
+
+    sig(1);
+    sig(2);
+    ASSERT_TRUE(wait_until_true([&]() { return loop->pending() == 1; }));
+    loop->drain();
+    ASSERT_EQ(last, 2);
+}
+
+// 测试：防抖期间断开连接，到期后不再调用
+TEST_CASE(debounce_disconnect_cancels)
+{
+    xswl::signal_t<> sig;
+    std::atomic<int> calls{0};
+
+    auto conn = sig.connect([&calls]() { calls.fetch_add(1); },
+                            xswl::connect_options_t().debounce(std::chrono::milliseconds(10)));
+    sig();
+    conn.disconnect();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(calls.load(), 0);
+}
+
+// 测试：定时轮在跨层下沉后按到期先后触发，且不早于设定延迟
+TEST_CASE(timer_wheel_ordering)
+{
+    std::mutex mutex;
+    std::vector<int> order;
+    std::atomic<int> fired{0};
+    auto start = std::chrono::steady_clock::now();
+    std::vector<long long> elapsed(3, 0);
+
+    const int delays[3] = {150, 5, 70};
+    for (int i = 0; i < 3; ++i)
+    {
+        xswl::detail::timer_wheel::instance().schedule(
+            std::chrono::milliseconds(delays[i]), [&, i]() {
+                std::lock_guard<std::mutex> lk(mutex);
+                order.push_back(i);
+                elapsed[i] = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+                fired.fetch_add(1);
+            });
+    }
+
+    ASSERT_TRUE(wait_until_true([&]() { return fired.load() == 3; }));
+    std::lock_guard<std::mutex> lk(mutex);
+    ASSERT_EQ(order[0], 1);
+    ASSERT_EQ(order[1], 2);
+    ASSERT_EQ(order[2], 0);
+    for (int i = 0; i < 3; ++i)
+        ASSERT_GE(elapsed[i], delays[i]);
+}
+
+// 测试：非正的节流间隔与防抖延迟在设置时被拒绝
+TEST_CASE(rate_limit_rejects_non_positive_interval)
+{
+    ASSERT_THROWS(xswl::connect_options_t().throttle(std::chrono::milliseconds(0)),
+                  std::invalid_argument);
+    ASSERT_THROWS(xswl::connect_options_t().throttle(std::chrono::milliseconds(-5)),
+                  std::invalid_argument);
+    ASSERT_THROWS(xswl::connect_options_t().debounce(std::chrono::seconds(0)),
+                  std::invalid_argument);
+    ASSERT_THROWS(xswl::connect_options_t().debounce(std::chrono::duration<double, std::nano>(0.5)),
+                  std::invalid_argument);
+
+    xswl::connect_options_t ok;
+    ok.throttle(std::chrono::nanoseconds(1));
+    ASSERT_TRUE(ok.rate_limit() == xswl::rate_limit_t::throttle);
+    ASSERT_EQ(ok.rate_interval().count(), 1);
+}
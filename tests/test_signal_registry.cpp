@@ -0,0 +1,175 @@
+#include "test_common.hpp"
+
+static const xswl::signal_info_t *find_info(const std::vector<xswl::signal_info_t> &infos,
+                                            const std::string &name)
+{
+    for (const auto &info : infos)
+        if (info.name == name)
+            return &info;
+    return nullptr;
+}
+
+// 测试：未登记的信号不出现；登记后列出连接数、发射次数与内存，销毁后自动注销
+TEST_CASE(registry_register_and_lifetime)
+{
+    std::size_t before = xswl::signal_registry::size();
+    {
+        xswl::signal_t<int> hidden;
+        hidden.set_name("registry_hidden");
+        ASSERT_FALSE(hidden.is_registered());
+
+        xswl::signal_t<int> sig;
+        sig.register_as("registry_register_and_lifetime");
+        ASSERT_TRUE(sig.is_registered());
+        ASSERT_EQ(sig.name(), std::string("registry_register_and_lifetime"));
+        ASSERT_EQ(xswl::signal_registry::size(), before + 1);
+
+        auto a = sig.connect([](int) {});
+        auto b = sig.connect([](int) {});
+        b.disconnect();
+        for (int i = 0; i < 10; ++i)
+            sig(i);
+        hidden(0);
+
+        auto infos = xswl::signal_registry::snapshot();
+        ASSERT_TRUE(find_info(infos, "registry_hidden") == nullptr);
+        const xswl::signal_info_t *info = find_info(infos, "registry_register_and_lifetime");
+        ASSERT_TRUE(info != nullptr);
+        ASSERT_EQ(info->slot_count, 1u);
+        ASSERT_EQ(info->emissions, 10u);
+        ASSERT_TRUE(info->emission_rate > 0.0);
+        ASSERT_EQ(info->memory.slot_count, 1u);
+        ASSERT_EQ(info->memory.total(), sig.memory_usage().total());
+    }
+    ASSERT_EQ(xswl::signal_registry::size(), before);
+    ASSERT_TRUE(find_info(xswl::signal_registry::snapshot(), "registry_register_and_lifetime") == nullptr);
+}
+
+// 测试：发射频率按两次快照之间的增量计算；注销后不再列出
+TEST_CASE(registry_rate_and_unregister)
+{
+    xswl::signal_t<> sig;
+    sig.register_as("registry_rate_and_unregister");
+    sig.connect([] {});
+    sig();
+    xswl::signal_registry::snapshot();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    std::vector<xswl::signal_info_t> infos = xswl::signal_registry::snapshot();
+    const xswl::signal_info_t *info = find_info(infos, "registry_rate_and_unregister");
+    ASSERT_TRUE(info != nullptr);
+    ASSERT_EQ(info->emissions, 1u);
+    ASSERT_TRUE(info->emission_rate == 0.0);
+
+    sig.unregister();
+    ASSERT_FALSE(sig.is_registered());
+    ASSERT_TRUE(find_info(xswl::signal_registry::snapshot(), "registry_rate_and_unregister") == nullptr);
+    sig.register_as("registry_rate_and_unregister");
+    ASSERT_TRUE(find_info(xswl::signal_registry::snapshot(), "registry_rate_and_unregister") != nullptr);
+}
+
+// 测试：开启采样剖析后快照包含平均扇出与发射耗时
+TEST_CASE(registry_reports_sampled_cost)
+{
+    xswl::signal_t<int> sig;
+    sig.register_as("registry_reports_sampled_cost");
+    for (int i = 0; i < 3; ++i)
+        sig.connect([](int) {});
+
+    xswl::profiler::start(1);
+    for (int i = 0; i < 10; ++i)
+        sig(i);
+    xswl::profiler::stop();
+
+    std::vector<xswl::signal_info_t> infos = xswl::signal_registry::snapshot();
+    const xswl::signal_info_t *info = find_info(infos, "registry_reports_sampled_cost");
+    ASSERT_TRUE(info != nullptr);
+    ASSERT_TRUE(info->mean_fanout > 2.99 && info->mean_fanout < 3.01);
+    ASSERT_GT(info->mean_emit_duration.count(), 0);
+}
+
+// 测试：多个线程同时登记、发射、销毁与查询快照
+TEST_CASE(registry_concurrent_registration)
+{
+    std::size_t before = xswl::signal_registry::size();
+    std::atomic<bool> stop{false};
+    std::thread reader([&] {
+        while (!stop.load())
+            xswl::signal_registry::snapshot();
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([t] {
+            for (int i = 0; i < 200; ++i)
+            {
+                xswl::signal_t<int> sig;
+                sig.register_as("registry_concurrent_" + std::to_string(t));
+                sig.connect([](int) {});
+                sig(i);
+            }
+        });
+    for (auto &t : threads)
+        t.join();
+    stop.store(true);
+    reader.join();
+
+    ASSERT_EQ(xswl::signal_registry::size(), before);
+}
+
+// 测试：同一信号上并发登记与注销，结束后登记标志与登记表一致
+TEST_CASE(registry_register_unregister_race)
+{
+    std::size_t before = xswl::signal_registry::size();
+    xswl::signal_t<int> sig;
+
+    for (int round = 0; round < 200; ++round)
+    {
+        std::thread a([&sig] { sig.register_as("registry_race"); });
+        std::thread b([&sig] { sig.unregister(); });
+        a.join();
+        b.join();
+
+        std::size_t expected = before + (sig.is_registered() ? 1u : 0u);
+        ASSERT_EQ(xswl::signal_registry::size(), expected);
+        sig.unregister();
+        ASSERT_EQ(xswl::signal_registry::size(), before);
+    }
+}
+
+// 测试：多个线程同时对同一信号取快照，发射次数单调且频率不为负
+TEST_CASE(registry_concurrent_snapshots)
+{
+    xswl::signal_t<> sig;
+    sig.register_as("registry_concurrent_snapshots");
+    sig.connect([] {});
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> bad{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t)
+        readers.emplace_back([&] {
+            std::uint64_t last = 0;
+            while (!stop.load())
+            {
+                std::vector<xswl::signal_info_t> infos = xswl::signal_registry::snapshot();
+                const xswl::signal_info_t *info = find_info(infos, "registry_concurrent_snapshots");
+                if (info == nullptr || info->emissions < last || info->emission_rate < 0.0)
+                    bad.fetch_add(1);
+                else
+                    last = info->emissions;
+            }
+        });
+
+    for (int i = 0; i < 20000; ++i)
+        sig();
+    stop.store(true);
+    for (auto &t : readers)
+        t.join();
+
+    ASSERT_EQ(bad.load(), 0);
+    std::vector<xswl::signal_info_t> infos = xswl::signal_registry::snapshot();
+    const xswl::signal_info_t *info = find_info(infos, "registry_concurrent_snapshots");
+    ASSERT_TRUE(info != nullptr);
+    ASSERT_EQ(info->emissions, 20000u);
+}
@@ -0,0 +1,139 @@
+#include "test_common.hpp"
+
+// 测试：未开启统计时不记录；开启后计入调用次数、累计与最大耗时
+TEST_CASE(slot_stats_counts_calls)
+{
+    xswl::signal_t<int> sig;
+    auto conn = sig.connect([](int ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    });
+
+    sig(0);
+    ASSERT_FALSE(sig.stats_enabled());
+    ASSERT_EQ(conn.stats().calls, 0u);
+    ASSERT_TRUE(sig.slot_stats().empty());
+
+    sig.enable_stats();
+    ASSERT_TRUE(sig.stats_enabled());
+    sig(0);
+    sig(2);
+    sig(0);
+
+    xswl::slot_stats_t stats = conn.stats();
+    ASSERT_EQ(stats.calls, 3u);
+    ASSERT_EQ(stats.exceptions, 0u);
+    ASSERT_GE(stats.max.count(), std::chrono::nanoseconds(std::chrono::milliseconds(2)).count());
+    ASSERT_GE(stats.total.count(), stats.max.count());
+    ASSERT_EQ(stats.average().count(), stats.total.count() / 3);
+
+    // 关闭后停止记录，已有数据保留
+    sig.enable_stats(false);
+    sig(0);
+    ASSERT_EQ(conn.stats().calls, 3u);
+}
+
+// 测试：抛出异常的调用计入 exceptions，被阻塞的槽不计入
+TEST_CASE(slot_stats_exceptions_and_blocked)
+{
+    xswl::signal_t<bool> sig;
+    sig.enable_stats();
+    auto conn = sig.connect([](bool fail) {
+        if (fail)
+            throw std::runtime_error("slot failure");
+    });
+
+    sig(false);
+    sig(true);
+    sig(true);
+    conn.block();
+    sig(true);
+
+    xswl::slot_stats_t stats = conn.stats();
+    ASSERT_EQ(stats.calls, 3u);
+    ASSERT_EQ(stats.exceptions, 2u);
+}
+
+// 测试：信号级汇总按累计耗时排序，便于找出占用时间最多的槽
+TEST_CASE(slot_stats_dump_sorted_by_total)
+{
+    xswl::signal_t<> sig;
+    sig.enable_stats();
+    auto fast = sig.connect([] {});
+    auto slow = sig.connect([] { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+    auto gone = sig.connect([] {});
+
+    for (int i = 0; i < 3; ++i)
+        sig();
+    gone.disconnect();
+
+    auto dump = sig.slot_stats();
+    ASSERT_EQ(dump.size(), 2u);
+    ASSERT_TRUE(dump[0].first.is_connected());
+    ASSERT_EQ(dump[0].second.calls, 3u);
+    ASSERT_GE(dump[0].second.total.count(), dump[1].second.total.count());
+    ASSERT_EQ(dump[0].second.total.count(), slow.stats().total.count());
+    ASSERT_EQ(dump[1].second.total.count(), fast.stats().total.count());
+}
+
+// 测试：排队连接在执行器上真正调用时计入，投递本身不计入
+TEST_CASE(slot_stats_queued_delivery)
+{
+    auto loop = std::make_shared<xswl::event_loop_t>();
+    xswl::signal_t<int> sig;
+    sig.enable_stats();
+    auto conn = sig.connect([](int) {}, xswl::connect_options_t().queued(loop));
+
+    sig(1);
+    sig(2);
+    ASSERT_EQ(conn.stats().calls, 0u);
+    loop->drain();
+    ASSERT_EQ(conn.stats().calls, 2u);
+}
+
+// 测试：多个线程同时发射时计数不丢失；返回值信号同样统计
+TEST_CASE(slot_stats_concurrent_and_combined)
+{
+    xswl::signal_t<> sig;
+    sig.enable_stats();
+    auto conn = sig.connect([] {});
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&sig] {
+            for (int i = 0; i < 1000; ++i)
+                sig();
+        });
+    for (auto &t : threads)
+        t.join();
+    ASSERT_EQ(conn.stats().calls, 4000u);
+
+    xswl::signal_t<int(int)> square;
+    square.enable_stats();
+    auto sq = square.connect([](int v) { return v * v; });
+    ASSERT_EQ(square(3), 9);
+    ASSERT_EQ(sq.stats().calls, 1u);
+}
+
+// 测试：返回值信号的槽耗时不包括合并器的耗时
+TEST_CASE(slot_stats_exclude_combiner)
+{
+    struct slow_combiner
+    {
+        typedef int result_type;
+        bool operator()(int)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            return true;
+        }
+        int result() const { return 0; }
+    };
+
+    xswl::signal_t<int()> sig;
+    sig.enable_stats();
+    auto conn = sig.connect([] { return 1; });
+    sig.combine(slow_combiner());
+
+    xswl::slot_stats_t stats = conn.stats();
+    ASSERT_EQ(stats.calls, 1u);
+    ASSERT_LT(stats.max.count(), std::chrono::nanoseconds(std::chrono::milliseconds(10)).count());
+}
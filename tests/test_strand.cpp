@@ -0,0 +1,110 @@
+#include "test_common.hpp"
+
+// 测试：同一 strand 上的任务按顺序执行且从不并发
+TEST_CASE(strand_serializes_tasks)
+{
+    auto pool = std::make_shared<xswl::thread_pool_t>(4);
+    auto strand = std::make_shared<xswl::strand_t>(pool);
+
+    std::atomic<int> in_flight{0};
+    std::atomic<bool> overlapped{false};
+    std::atomic<bool> outside{false};
+    std::vector<int> order; // 无锁访问，由 strand 保证串行
+    std::atomic<int> done{0};
+
+    const int n = 2000;
+    for (int i = 0; i < n; ++i)
+    {
+        strand->post([&, i]() {
+            if (in_flight.fetch_add(1) != 0)
+                overlapped.store(true);
+            if (!strand->running_in_this_thread())
+                outside.store(true);
+            order.push_back(i);
+            in_flight.fetch_sub(1);
+            done.fetch_add(1);
+        });
+    }
+
+    while (done.load() < n)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    ASSERT_FALSE(overlapped.load());
+    ASSERT_FALSE(outside.load());
+    ASSERT_EQ(order.size(), static_cast<std::size_t>(n));
+    for (int i = 0; i < n; ++i)
+        ASSERT_EQ(order[i], i);
+    ASSERT_FALSE(strand->running_in_this_thread());
+}
+
+// 测试：多个排队连接绑定同一 strand，槽内不加锁也不会并发
+TEST_CASE(strand_bound_connections)
+{
+    auto pool = std::make_shared<xswl::thread_pool_t>(4);
+    auto strand = std::make_shared<xswl::strand_t>(pool);
+
+    xswl::signal_t<int> sig_a;
+    xswl::signal_t<int> sig_b;
+    long long state = 0; // 两个监听者共享的非原子状态
+    std::atomic<int> in_flight{0};
+    std::atomic<bool> overlapped{false};
+    std::atomic<int> calls{0};
+
+    auto listener = [&](int v) {
+        if (in_flight.fetch_add(1) != 0)
+            overlapped.store(true);
+        state += v;
+        in_flight.fetch_sub(1);
+        calls.fetch_add(1);
+    };
+    sig_a.connect(listener, xswl::connect_options_t().queued(strand));
+    sig_b.connect(listener, xswl::connect_options_t().queued(strand));
+
+    std::thread ta([&]() { for (int i = 0; i < 1000; ++i) sig_a(1); });
+    std::thread tb([&]() { for (int i = 0; i < 1000; ++i) sig_b(2); });
+    ta.join();
+    tb.join();
+
+    while (calls.load() < 2000)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    ASSERT_FALSE(overlapped.load());
+    ASSERT_EQ(state, 3000);
+}
+
+// 测试：不同 strand 可以在线程池上并行执行
+TEST_CASE(strands_run_in_parallel)
+{
+    if (std::thread::hardware_concurrency() < 2)
+        return;
+
+    auto pool = std::make_shared<xswl::thread_pool_t>(2);
+    xswl::strand_t s1(pool);
+    xswl::strand_t s2(pool);
+
+    std::atomic<int> arrived{0};
+    std::atomic<bool> both{false};
+    auto rendezvous = [&]() {
+        arrived.fetch_add(1);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (arrived.load() < 2 && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        if (arrived.load() == 2)
+            both.store(true);
+    };
+
+    std::promise<void> p1, p2;
+    s1.post([&]() { rendezvous(); p1.set_value(); });
+    s2.post([&]() { rendezvous(); p2.set_value(); });
+    p1.get_future().wait();
+    p2.get_future().wait();
+
+    ASSERT_TRUE(both.load());
+}
+
+// 测试：没有底层执行器的 strand 在构造时被拒绝，而不是静默积压任务
+TEST_CASE(strand_rejects_null_executor)
+{
+    ASSERT_THROWS(xswl::strand_t(std::shared_ptr<xswl::executor_t>()), std::invalid_argument);
+    ASSERT_THROWS(std::make_shared<xswl::strand_t>(nullptr), std::invalid_argument);
+}
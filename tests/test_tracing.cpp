@@ -0,0 +1,150 @@
+// 本文件所在的测试程序以 XSWL_SIGNALS_TRACING 编译
+#include "test_common.hpp"
+
+#include <cstdio>
+
+static std::size_t count_occurrences(const std::string &text, const std::string &needle)
+{
+    std::size_t n = 0;
+    for (std::size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1))
+        ++n;
+    return n;
+}
+
+// 每个测试开始前清空之前的记录，结束时停止记录
+struct trace_session
+{
+    explicit trace_session(std::size_t capacity = 0)
+    {
+        xswl::trace::clear();
+        xswl::trace::start(capacity);
+    }
+    ~trace_session() { xswl::trace::stop(); }
+};
+
+// 测试：名称驻留，未命名信号返回空串
+TEST_CASE(trace_signal_name)
+{
+    xswl::signal_t<int> sig;
+    ASSERT_TRUE(sig.name().empty());
+    sig.set_name("value_changed");
+    ASSERT_EQ(sig.name(), std::string("value_changed"));
+}
+
+// 测试：每次发射记录一个 emit 事件，每个槽调用记录一个 slot 事件
+TEST_CASE(trace_records_emit_and_slots)
+{
+    xswl::signal_t<int> sig;
+    sig.set_name("trace_records_emit_and_slots");
+    int total = 0;
+    sig.connect([&](int v) { total += v; });
+    sig.connect([&](int v) { total += v; });
+
+    trace_session session;
+    sig(1);
+    sig(2);
+    xswl::trace::stop();
+
+    ASSERT_EQ(total, 6);
+    std::string json = xswl::trace::export_chrome_json();
+    ASSERT_TRUE(json.find("\"traceEvents\"") != std::string::npos);
+    ASSERT_EQ(count_occurrences(json, "\"name\":\"trace_records_emit_and_slots\",\"cat\":\"emit\""), 2u);
+    ASSERT_EQ(count_occurrences(json, "\"name\":\"trace_records_emit_and_slots\",\"cat\":\"slot\""), 4u);
+    ASSERT_TRUE(json.find("\"ph\":\"X\"") != std::string::npos);
+}
+
+// 测试：未开启时不记录
+TEST_CASE(trace_inactive_records_nothing)
+{
+    xswl::signal_t<> sig;
+    sig.set_name("trace_inactive_records_nothing");
+    sig.connect([] {});
+    xswl::trace::clear();
+    ASSERT_FALSE(xswl::trace::active());
+    sig();
+    ASSERT_EQ(count_occurrences(xswl::trace::export_chrome_json(), "trace_inactive_records_nothing"), 0u);
+}
+
+// 测试：clear() 丢弃之前的记录
+TEST_CASE(trace_clear_drops_previous_events)
+{
+    xswl::signal_t<> sig;
+    sig.set_name("trace_clear_drops_previous_events");
+    sig.connect([] {});
+    trace_session session;
+    sig();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    xswl::trace::clear();
+    ASSERT_EQ(count_occurrences(xswl::trace::export_chrome_json(), "trace_clear_drops_previous_events"), 0u);
+    sig();
+    ASSERT_EQ(count_occurrences(xswl::trace::export_chrome_json(),
+                                "\"name\":\"trace_clear_drops_previous_events\",\"cat\":\"emit\""),
+              1u);
+}
+
+// 测试：各线程使用独立缓冲区并导出线程名；缓冲区写满后只保留最新的记录
+TEST_CASE(trace_per_thread_rings)
+{
+    xswl::signal_t<> sig;
+    sig.set_name("trace_per_thread_rings");
+    sig.connect([] {});
+    trace_session session(8);
+
+    std::thread worker([&] {
+        xswl::trace::set_thread_name("trace \"worker\"");
+        for (int i = 0; i < 100; ++i)
+            sig();
+    });
+    worker.join();
+    xswl::trace::stop();
+
+    std::string json = xswl::trace::export_chrome_json();
+    ASSERT_TRUE(json.find("\"thread_name\"") != std::string::npos);
+    ASSERT_TRUE(json.find("trace \\\"worker\\\"") != std::string::npos);
+    ASSERT_EQ(count_occurrences(json, "\"name\":\"trace_per_thread_rings\""), 8u);
+}
+
+static std::size_t registered_rings()
+{
+    xswl::trace::detail::registry &r = xswl::trace::detail::registry::instance();
+    std::lock_guard<std::mutex> lk(r.mutex);
+    return r.rings.size();
+}
+
+// 测试：已退出线程的缓冲区被之后的线程复用，旧线程的记录仍可导出
+TEST_CASE(trace_rings_recycled_after_thread_exit)
+{
+    xswl::signal_t<> sig;
+    sig.set_name("trace_rings_recycled");
+    sig.connect([] {});
+    trace_session session(64);
+
+    std::thread([&] { sig(); }).join();
+    const std::size_t baseline = registered_rings();
+    for (int i = 0; i < 20; ++i)
+        std::thread([&] { sig(); }).join();
+    ASSERT_LE(registered_rings(), baseline);
+    xswl::trace::stop();
+
+    std::string json = xswl::trace::export_chrome_json();
+    // 每次发射记录发射与槽调用两条
+    ASSERT_EQ(count_occurrences(json, "\"name\":\"trace_rings_recycled\""), 42u);
+}
+
+// 测试：写入文件
+TEST_CASE(trace_write_file)
+{
+    xswl::signal_t<> sig;
+    sig.connect([] {});
+    trace_session session;
+    sig();
+    std::string path = "xswl_trace_test.json";
+    ASSERT_TRUE(xswl::trace::write_chrome_json(path));
+    std::FILE *f = std::fopen(path.c_str(), "rb");
+    ASSERT_TRUE(f != nullptr);
+    char buf[16] = {};
+    ASSERT_GT(std::fread(buf, 1, sizeof(buf) - 1, f), 0u);
+    std::fclose(f);
+    std::remove(path.c_str());
+    ASSERT_EQ(buf[0], '{');
+}
@@ -0,0 +1,94 @@
+#include "test_common.hpp"
+
+// 测试：没有发射时 wait 在超时后返回 false
+TEST_CASE(wait_times_out)
+{
+    xswl::signal_t<int> sig;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(sig.wait(std::chrono::milliseconds(20)));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+}
+
+// 测试：其他线程发射后 wait 返回，且该次发射的槽已经调用完毕
+TEST_CASE(wait_wakes_on_emission)
+{
+    xswl::signal_t<int> sig;
+    std::atomic<int> slot_value{0};
+    sig.connect([&slot_value](int v) { slot_value.store(v); });
+
+    std::thread emitter([&sig]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        sig(7);
+    });
+
+    ASSERT_TRUE(sig.wait(std::chrono::seconds(5)));
+    ASSERT_EQ(slot_value.load(), 7);
+    emitter.join();
+}
+
+// 测试：wait_for 取回发射参数；没有槽的信号同样可以等待
+TEST_CASE(wait_for_captures_args)
+{
+    xswl::signal_t<int, std::string> sig;
+    std::tuple<int, std::string> args;
+
+    std::thread emitter([&sig]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        sig(42, "answer");
+    });
+
+    ASSERT_TRUE(sig.wait_for(args, std::chrono::seconds(5)));
+    ASSERT_EQ(std::get<0>(args), 42);
+    ASSERT_EQ(std::get<1>(args), "answer");
+    emitter.join();
+}
+
+// 测试：多个等待者被同一次发射全部唤醒
+TEST_CASE(wait_multiple_waiters)
+{
+    xswl::signal_t<> sig;
+    std::atomic<int> woken{0};
+    std::atomic<int> ready{0};
+
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < 4; ++i)
+    {
+        waiters.emplace_back([&]() {
+            ready.fetch_add(1);
+            if (sig.wait(std::chrono::seconds(5)))
+                woken.fetch_add(1);
+        });
+    }
+
+    // 持续发射直到所有等待者都被唤醒，避免依赖线程启动时机
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (woken.load() < 4 && std::chrono::steady_clock::now() < deadline)
+    {
+        if (ready.load() == 4)
+            sig();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for (auto &t : waiters)
+        t.join();
+
+    ASSERT_EQ(woken.load(), 4);
+}
+
+// 测试：返回值信号也支持等待，超时的等待者不影响后续发射
+TEST_CASE(wait_return_signal_and_timeout_cleanup)
+{
+    xswl::signal_t<int(int)> sig;
+    sig.connect([](int v) { return v * 2; });
+
+    ASSERT_FALSE(sig.wait(std::chrono::milliseconds(1)));
+    ASSERT_EQ(sig(3), 6); // 超时的节点已摘除，发射不会访问它
+
+    std::tuple<int> args;
+    std::thread emitter([&sig]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        sig(5);
+    });
+    ASSERT_TRUE(sig.wait_for(args, std::chrono::seconds(5)));
+    ASSERT_EQ(std::get<0>(args), 5);
+    emitter.join();
+}